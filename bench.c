@@ -0,0 +1,689 @@
+/*
+ * Micro benchmarks for the editor internals. Build with `make bench` and run
+ * `./bench <name> [args]`; run it without arguments for the list.
+ */
+#define main editorMain
+#include "main.c"
+#undef main
+
+double benchNow() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* Fill path with roughly `bytes` bytes of log-like lines, with a rare error every 100k lines */
+void benchGenerateFile(const char *path, long long bytes) {
+  FILE *fp = fopen(path, "w");
+  if (!fp) die("fopen");
+  long long written = 0;
+  long long n = 0;
+  while (written < bytes) {
+    int len = n % 100003 == 99999 ?
+      fprintf(fp, "%08lld 2024-02-22T10:00:00 ERROR worker=%lld disk quota exceeded user=%lld\n",
+        n, n % 64, n % 977) :
+      fprintf(fp, "%08lld 2024-02-22T10:00:00 INFO worker=%lld request handled in %lld ms\n",
+      n, n % 64, (n * 7919) % 1000);
+    written += len;
+    n++;
+  }
+  fclose(fp);
+}
+
+/* Drop the current buffer so the next editorOpen starts from scratch */
+void benchResetEditor() {
+  int j;
+  hlStop(); /* it reads the rows */
+  for (j = 0; j < ECONFIG.numrows; j++) editorFreeRow(&ECONFIG.row[j]);
+  free(ECONFIG.row);
+  free(ECONFIG.filename);
+  searchClear();
+  trigramDiscard();
+  rowIndexDiscard();
+  viewClose();
+  compareClose();
+  if (ECONFIG.diskwatch > 0) close(ECONFIG.diskwatch);
+  free(ECONFIG.screen.line);
+  free(ECONFIG.screen.dirty);
+  memset(&ECONFIG, 0, sizeof(ECONFIG));
+  pthread_mutex_init(&ECONFIG.search.lock, NULL);
+  ECONFIG.disk_size = -1;
+  ECONFIG.journal.fd = -1;
+  ECONFIG.diskwatch = -1;
+  ECONFIG.undo.limit = EDITOR_UNDO_LIMIT;
+  ECONFIG.screenrows = 24;
+  ECONFIG.screencols = 80;
+}
+
+long long benchParseSize(const char *s) {
+  char *end;
+  long long n = strtoll(s, &end, 10);
+  switch (*end) {
+    case 'k': case 'K': n <<= 10; break;
+    case 'm': case 'M': n <<= 20; break;
+    case 'g': case 'G': n <<= 30; break;
+  }
+  return n;
+}
+
+/* Edit one line near the end of a big file and save it, incremental vs full rewrite */
+void benchSave(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (2LL << 30);
+  const char *path = "bench_save.tmp";
+  double t;
+
+  benchGenerateFile(path, bytes);
+  benchResetEditor();
+
+  t = benchNow();
+  editorOpen((char *) path);
+  printf("open:            %8.3f s  (%d rows, %lld bytes)\n", benchNow() - t,
+    ECONFIG.numrows, (long long) ECONFIG.disk_size);
+
+  editorRowInsertChar(&ECONFIG.row[ECONFIG.numrows - 10], 0, 'X');
+  t = benchNow();
+  editorSave();
+  printf("save, tail:      %8.3f s  %s\n", benchNow() - t, ECONFIG.statusmsg);
+
+  editorRowDelChar(&ECONFIG.row[ECONFIG.numrows - 10], 0);
+  editorRowInsertChar(&ECONFIG.row[ECONFIG.numrows - 10], 0, 'Y');
+  t = benchNow();
+  editorSave();
+  printf("save, in place:  %8.3f s  %s\n", benchNow() - t, ECONFIG.statusmsg);
+
+  editorRowInsertChar(&ECONFIG.row[ECONFIG.numrows - 10], 0, 'Z');
+  ECONFIG.disk_size = -1; /* forget what is on disk */
+  t = benchNow();
+  editorSave();
+  printf("save, full:      %8.3f s  %s\n", benchNow() - t, ECONFIG.statusmsg);
+
+  benchResetEditor();
+  unlink(path);
+}
+
+/* Run a find-all to completion, returns the seconds it took */
+double benchFindAll(const char *query, int regex) {
+  double t = benchNow();
+  searchStart(query, regex);
+  while (!ECONFIG.search.done) {
+    searchPoll();
+    usleep(100);
+  }
+  return benchNow() - t;
+}
+
+/* Count rows with a match and all matches using one matcher, like grep -c and grep -o | wc -l */
+void benchRegexScan(const char *label, struct regex *re, const char *pattern, double bytes) {
+  struct editorMatcher m;
+  long long rows = 0, matches = 0;
+  int j, at, len;
+  double t = benchNow();
+
+  matcherInit(&m, pattern, re);
+  for (j = 0; j < ECONFIG.numrows; j++) {
+    int found = 0;
+    at = 0;
+    while ((at = editorRowFind(&m, &ECONFIG.row[j], at, &len)) != -1) {
+      found = 1;
+      matches++;
+      at += len;
+    }
+    rows += found;
+  }
+  matcherFree(&m);
+  t = benchNow() - t;
+  printf("%-22s %8.3f s  %8.1f MB/s  (%lld rows, %lld matches)\n", label, t, bytes / t / 1e6, rows, matches);
+}
+
+/* Regex search over a log-like file: literal prefilter on and off, the worker pool, and grep -E */
+void benchRegex(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (512LL << 20);
+  const char *pattern = argc > 1 ? argv[1] : "INFO worker=63 .* in 99[0-9] ms";
+  const char *path = "bench_regex.tmp";
+  const char *error;
+  char cmd[512];
+  double t;
+
+  benchGenerateFile(path, bytes);
+  benchResetEditor();
+  editorOpen((char *) path);
+  trigramDiscard(); /* measure the matcher on its own */
+
+  struct regex *re = regexCompile(pattern, &error);
+  if (re == NULL) {
+    fprintf(stderr, "bad pattern: %s\n", error);
+    exit(1);
+  }
+  printf("pattern: %s  (required literal \"%.*s\")\n", pattern, re->literallen, re->literal);
+
+  benchRegexScan("regex:", re, pattern, bytes);
+  int literallen = re->literallen;
+  re->literallen = 0;
+  benchRegexScan("regex, no prefilter:", re, pattern, bytes);
+  re->literallen = literallen;
+  regexFree(re);
+
+  t = benchFindAll(pattern, 1);
+  printf("%-22s %8.3f s  %8.1f MB/s  (%zu matches)\n", "find-all workers:", t, bytes / t / 1e6,
+    ECONFIG.search.nmatches);
+  searchClear();
+
+  snprintf(cmd, sizeof(cmd), "grep -E -c '%s' %s", pattern, path);
+  fflush(stdout);
+  t = benchNow();
+  FILE *fp = popen(cmd, "r");
+  long long rows = 0;
+  if (fp == NULL || fscanf(fp, "%lld", &rows) != 1) rows = -1;
+  if (fp) pclose(fp);
+  t = benchNow() - t;
+  printf("%-22s %8.3f s  %8.1f MB/s  (%lld rows)\n", "grep -E -c:", t, bytes / t / 1e6, rows);
+
+  benchResetEditor();
+  unlink(path);
+}
+
+/* Repeated searches on a big file: full scans vs the trigram index, built and then loaded */
+void benchTrigram(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (1LL << 30);
+  const char *queries[] = {"disk quota exceeded", "00123456 2024", "panic"};
+  const char *path = "bench_trigram.tmp";
+  char *index = editorSidecarPath(path, "ftrigram");
+  unsigned int j;
+  double t;
+
+  benchGenerateFile(path, bytes);
+  unlink(index);
+  setenv("FLY_TRIGRAM_MIN", "0", 1);
+  benchResetEditor();
+
+  t = benchNow();
+  editorOpen((char *) path);
+  printf("open:         %8.3f s\n", benchNow() - t);
+  t = benchNow();
+  while (!__atomic_load_n(&ECONFIG.trigram.ready, __ATOMIC_ACQUIRE)) usleep(1000);
+  struct stat st;
+  stat(index, &st);
+  printf("index build:  %8.3f s  (%d blocks, %lld bytes)\n", benchNow() - t, ECONFIG.trigram.numblocks,
+    (long long) st.st_size);
+
+  for (j = 0; j < sizeof(queries) / sizeof(queries[0]); j++) {
+    ECONFIG.trigram.ready = 0;
+    double scan = benchFindAll(queries[j], 0);
+    size_t n = ECONFIG.search.nmatches;
+    ECONFIG.trigram.ready = 1;
+    double indexed = benchFindAll(queries[j], 0);
+    printf("%-20s full scan %8.3f s, indexed %8.4f s  (%zu / %zu matches)\n", queries[j], scan, indexed,
+      n, ECONFIG.search.nmatches);
+  }
+
+  benchResetEditor();
+  t = benchNow();
+  editorOpen((char *) path);
+  printf("reopen:       %8.3f s  (index %s)\n", benchNow() - t, ECONFIG.trigram.map ? "loaded" : "rebuilt");
+  t = benchFindAll(queries[0], 0);
+  printf("%-20s indexed %8.4f s  (%zu matches)\n", queries[0], t, ECONFIG.search.nmatches);
+  searchClear();
+
+  /* replace-all asks the index for its rows before its own edit drops it */
+  t = benchNow();
+  long long n = editorReplaceAll(queries[0], 0, "disk quota raised");
+  double indexed = benchNow() - t;
+  benchResetEditor();
+  editorOpen((char *) path);
+  ECONFIG.trigram.ready = 0;
+  t = benchNow();
+  long long scanned = editorReplaceAll(queries[0], 0, "disk quota raised");
+  printf("replace-all          full scan %8.3f s, indexed %8.4f s  (%lld / %lld matches)\n", benchNow() - t, indexed,
+    scanned, n);
+
+  benchResetEditor();
+  unlink(path);
+  unlink(index);
+  free(index);
+}
+
+/* Fill path with copies of fmt, each formatted with a counter, until it holds `bytes` bytes */
+void benchGenerateText(const char *path, long long bytes, const char *fmt) {
+  FILE *fp = fopen(path, "w");
+  if (!fp) die("fopen");
+  long long written = 0;
+  int n = 0;
+  while (written < bytes) {
+    written += fprintf(fp, fmt, n, n, n, n);
+    n++;
+  }
+  fclose(fp);
+}
+
+/* Lex a whole file from scratch on this thread, returns the seconds it took */
+double benchHighlightFile(const char *path) {
+  int j, state = 0;
+  benchResetEditor();
+  editorOpen((char *) path);
+  trigramDiscard();
+  double t = benchNow();
+  for (j = 0; j < ECONFIG.numrows; j++) {
+    editorHighlightRow(&ECONFIG.row[j], state);
+    state = ECONFIG.row[j].hl_out;
+  }
+  return benchNow() - t;
+}
+
+/* Draw a frame and wait for the background highlighter to finish the screen */
+void benchHighlightFrame(const char *label) {
+  struct appendbuffer ab = APPENDBUFFER_INIT;
+  double t = benchNow();
+  drawRows(&ab);
+  double draw = benchNow() - t;
+  aBufferFree(&ab);
+  while (ECONFIG.hlfrom < ECONFIG.numrows) {
+    usleep(100);
+    if (hlPoll()) editorHighlightRows(ECONFIG.screenrows + EDITOR_HL_LOOKAHEAD);
+  }
+  printf("%-24s draw %6.2f ms, colored after %6.1f ms\n", label, draw * 1e3, (benchNow() - t) * 1e3);
+}
+
+/* Highlighting throughput of each generated lexer, and one long JSON line */
+void benchHighlight(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (32LL << 20);
+  long long line = argc > 1 ? benchParseSize(argv[1]) : (50LL << 20);
+  struct {
+    const char *path, *fmt;
+  } corpora[] = {
+    {"bench_hl.c", "/* handler %d */\nstatic int handle%d(struct req *r, const char *name) {\n"
+      "  if (r->len > %d && name[0] != '\\0') return strlen(\"x\\n\") + 0x%x; // fast path\n}\n"},
+    {"bench_hl.json", "{\"id\": %d, \"name\": \"user %d\", \"tags\": [\"a\", \"b\"], "
+      "\"score\": %d.5, \"active\": true, \"ref\": null}\n"},
+    {"bench_hl.yaml", "- id: %d\n  name: \"user %d\"\n  enabled: true  # flag\n  ratio: 0.%d\n  tags: [a, b]\n"},
+    {"bench_hl.sh", "for f in \"$DIR\"/*.log; do  # pass %d\n"
+      "  if [ -n \"${f}\" ]; then echo 'x %d' >> \"$out_%d\"; fi\ndone\n"},
+  };
+  unsigned int j;
+  double t;
+
+  for (j = 0; j < sizeof(corpora) / sizeof(corpora[0]); j++) {
+    benchGenerateText(corpora[j].path, bytes, corpora[j].fmt);
+    t = benchHighlightFile(corpora[j].path);
+    printf("%-6s %8.3f s  %8.1f MB/s  (%d rows)\n", ECONFIG.syntax->filetype, t, bytes / t / 1e6, ECONFIG.numrows);
+    unlink(corpora[j].path);
+  }
+
+  /* one line: the whole row is lexed again after each edit to it */
+  const char *path = "bench_hl_line.json";
+  benchGenerateText(path, line, "{\"id\": %d, \"name\": \"user %d\", \"score\": %d.5, \"active\": true}, ");
+  t = benchHighlightFile(path);
+  printf("json, one %lld MB line: %6.1f ms  %8.1f MB/s\n", line >> 20, t * 1e3, line / t / 1e6);
+  ECONFIG.hlfrom = 0;
+  ECONFIG.row[0].hl_version--;
+  benchHighlightFrame("json line, opened:");
+  editorRowInsertChar(&ECONFIG.row[0], 0, '[');
+  benchHighlightFrame("json line, edited:");
+
+  /* replace-all while the background highlighter's colors for the line wait to be adopted */
+  editorRowInsertChar(&ECONFIG.row[0], 0, ' ');
+  editorHighlightRows(0);
+  while (!__atomic_load_n(&ECONFIG.highlighter.published, __ATOMIC_ACQUIRE)) usleep(100);
+  t = benchNow();
+  long long n = editorReplaceAll("\"active\": true", 0, "\"active\": false");
+  printf("json line, replace-all:  %6.1f ms  (%lld matches)\n", (benchNow() - t) * 1e3, n);
+  benchHighlightFrame("json line, replaced:");
+
+  benchResetEditor();
+  unlink(path);
+}
+
+/* Re-render every row of path with one renderer, returns the seconds it took */
+double benchRenderRows(void (*render)(editorRow *)) {
+  int j;
+  double t = benchNow();
+  for (j = 0; j < ECONFIG.numrows; j++) render(&ECONFIG.row[j]);
+  return benchNow() - t;
+}
+
+/* Scroll to cx on row 0 and draw frames there, prints the first and the average after it */
+void benchRenderFrames(const char *label, int cx) {
+  struct appendbuffer ab = APPENDBUFFER_INIT;
+  int j, frames = 100;
+  ECONFIG.cy = 0;
+  ECONFIG.cx = cx;
+  double t = benchNow();
+  editorScroll();
+  drawRows(&ab);
+  double first = benchNow() - t;
+  t = benchNow();
+  for (j = 0; j < frames; j++) {
+    ab.len = 0;
+    editorScroll();
+    editorScreenInvalidate();
+    drawRows(&ab);
+  }
+  printf("%-22s first %8.3f ms  then %8.3f ms/frame\n", label, first * 1e3, (benchNow() - t) * 1e3 / frames);
+  aBufferFree(&ab);
+}
+
+/* editorUpdateRow's tab and control character expansion, scalar against SSE2, then frames on one huge line */
+void benchRender(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (64LL << 20);
+  long long line = argc > 1 ? benchParseSize(argv[1]) : (200LL << 20);
+  struct {
+    const char *label, *path, *fmt;
+  } corpora[] = {
+    {"makefile", "bench_render.mk", "obj/%d.o:\tsrc/%d.c\tinclude/%d.h\n\t$(CC)\t$(CFLAGS)\t-c -o $@ $<\t# %d\n"},
+    {"binary log", "bench_render.log", "%08d \x1b[32mINFO\x1b[0m\tid=%d \x01\x02\x03 seq=%d\x7f crc=%x\x1f\n"},
+    {"plain log", "bench_render.txt", "%08d 2024-02-22T10:00:00 INFO worker=%d request handled in %d ms (%d)\n"},
+  };
+  unsigned int j;
+
+  for (j = 0; j < sizeof(corpora) / sizeof(corpora[0]); j++) {
+    benchGenerateText(corpora[j].path, bytes, corpora[j].fmt);
+    benchResetEditor();
+    editorOpen((char *) corpora[j].path);
+    trigramDiscard();
+    double scalar = benchRenderRows(editorRenderRowScalar);
+#ifdef EDITOR_HAVE_SSE2
+    char *expect = strdup(ECONFIG.row[ECONFIG.numrows / 2].render);
+    double simd = benchRenderRows(editorRenderRowSSE2);
+    if (strcmp(expect, ECONFIG.row[ECONFIG.numrows / 2].render) != 0) printf("%s: renderers disagree\n", corpora[j].label);
+    free(expect);
+    printf("%-10s scalar %7.1f ms  sse2 %7.1f ms  %8.1f MB/s  (%d rows)\n", corpora[j].label,
+      scalar * 1e3, simd * 1e3, bytes / simd / 1e6, ECONFIG.numrows);
+#else
+    printf("%-10s scalar %7.1f ms  %8.1f MB/s  (%d rows)\n", corpora[j].label, scalar * 1e3, bytes / scalar / 1e6, ECONFIG.numrows);
+#endif
+    unlink(corpora[j].path);
+  }
+
+  /* one line: only the columns on screen should be walked, wherever the cursor is */
+  const char *path = "bench_render_line.txt";
+  benchGenerateText(path, line, "%d\tcol\xc3\xa9 \xe4\xb8\xad%d\x01 %d-%d ");
+  benchResetEditor();
+  editorOpen((char *) path);
+  trigramDiscard();
+  printf("one %lld MB line:\n", line >> 20);
+  benchRenderFrames("  start", 0);
+  benchRenderFrames("  middle", ECONFIG.row[0].size / 2);
+  benchRenderFrames("  end", ECONFIG.row[0].size);
+  editorRowInsertChar(&ECONFIG.row[0], ECONFIG.row[0].size / 2, 'x');
+  benchRenderFrames("  middle, edited", ECONFIG.row[0].size / 2);
+  unlink(path);
+  benchResetEditor();
+}
+
+/* Resident set of this process in MB */
+double benchResidentMB() {
+  long pages = 0, resident = 0;
+  FILE *fp = fopen("/proc/self/statm", "r");
+  if (fp) {
+    if (fscanf(fp, "%ld %ld", &pages, &resident) != 2) resident = 0;
+    fclose(fp);
+  }
+  return resident * (double) sysconf(_SC_PAGESIZE) / (1 << 20);
+}
+
+/* Draw one viewer frame, returns the seconds it took */
+double benchViewFrame() {
+  struct appendbuffer ab = APPENDBUFFER_INIT;
+  double t = benchNow();
+  drawRows(&ab);
+  t = benchNow() - t;
+  aBufferFree(&ab);
+  return t;
+}
+
+/* The read-only viewer: jumps before and after the line index covers the file, within a memory budget */
+void benchView(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (2LL << 30);
+  const char *path = "bench_view.log";
+  double t;
+  benchGenerateText(path, bytes, "%08d 2024-02-22T10:00:00 INFO worker=%d request handled in %d ms (%d)\n");
+  benchResetEditor();
+  ECONFIG.view.budget = argc > 1 ? benchParseSize(argv[1]) : (64LL << 20);
+
+  t = benchNow();
+  viewOpen((char *) path);
+  printf("open             %8.3f ms\n", (benchNow() - t) * 1e3);
+  printf("first frame      %8.3f ms\n", benchViewFrame() * 1e3);
+  t = benchNow();
+  viewSetTop(viewLineStart(ECONFIG.view.size / 2), -1);
+  t = benchNow() - t + benchViewFrame();
+  printf("jump to 50%%      %8.3f ms  (line %lld)\n", t * 1e3, ECONFIG.view.topline);
+  t = benchNow();
+  long long line = LLONG_MAX;
+  viewSetTop(viewLineOffset(&line), line);
+  t = benchNow() - t + benchViewFrame();
+  printf("jump to last line %7.1f ms  %8.1f MB/s indexed, %lld lines\n", t * 1e3, bytes / t / 1e6, line + 1);
+  t = benchNow();
+  viewSetTop(viewLineStart(ECONFIG.view.size / 2), -1);
+  t = benchNow() - t + benchViewFrame();
+  printf("jump to 50%%      %8.3f ms  (line %lld)\n", t * 1e3, ECONFIG.view.topline);
+  printf("resident         %8.1f MB  (budget %zu MB)\n", benchResidentMB(), ECONFIG.view.budget >> 20);
+
+  viewClose();
+  unlink(path);
+  benchResetEditor();
+}
+
+/* Following a log: appends in 1 MB writes, polled and drawn as the idle loop would every 10 MB */
+void benchFollow(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (1LL << 30);
+  const char *path = "bench_follow.log";
+  const char *line = "2024-02-22T10:00:00 INFO worker=7 request handled in 12 ms (ok)\n";
+  size_t linelen = strlen(line), piece = (1 << 20) / linelen * linelen;
+  char *buf = malloc(piece);
+  size_t j;
+  for (j = 0; j < piece; j += linelen) memcpy(buf + j, line, linelen);
+
+  int fd = open(path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0644);
+  if (fd == -1) die("open");
+  benchResetEditor();
+  viewOpen((char *) path);
+  viewFollow(1);
+
+  double spent = 0, worst = 0;
+  long long written = 0;
+  int ticks = 0;
+  while (written < bytes) {
+    for (j = 0; j < 10 && written < bytes; j++) {
+      if (write(fd, buf, piece) != (ssize_t) piece) die("write");
+      written += piece;
+    }
+    double t = benchNow();
+    if (viewPoll()) benchViewFrame();
+    t = benchNow() - t;
+    spent += t;
+    if (t > worst) worst = t;
+    ticks++;
+  }
+  printf("followed %lld MB in %d ticks: %8.1f ms total, %6.2f ms worst tick, %8.1f MB/s\n",
+    written >> 20, ticks, spent * 1e3, worst * 1e3, written / spent / 1e6);
+  printf("lines %lld (expected %lld), last line on screen: %s\n", ECONFIG.view.topline + ECONFIG.screenrows,
+    written / (long long) linelen, ECONFIG.view.starts[ECONFIG.screenrows] < 0 ? "yes" : "no");
+
+  close(fd);
+  free(buf);
+  viewClose();
+  unlink(path);
+  benchResetEditor();
+}
+
+/* Take in changes another program made to a big open file */
+void benchReload(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (64LL << 20);
+  const char *path = "bench_reload.txt";
+  double t;
+  int rows;
+
+  benchGenerateText(path, bytes, "%08d 2024-02-22T10:00:00 INFO worker=%d request handled in %d ms (%d)\n");
+  benchResetEditor();
+  editorOpen((char *) path);
+  printf("%d rows\n", ECONFIG.numrows);
+
+  int fd = open(path, O_WRONLY);
+  if (fd == -1) die("open");
+  if (pwrite(fd, "X", 1, ECONFIG.row[ECONFIG.numrows / 2].disk_off) != 1) die("pwrite");
+  if (lseek(fd, 0, SEEK_END) == -1) die("lseek");
+  t = benchNow();
+  rows = editorReload();
+  printf("one row changed: %8.3f ms  (%d rows replaced)\n", (benchNow() - t) * 1e3, rows);
+
+  const char *more = "appended by another program\n";
+  int j;
+  for (j = 0; j < 1000; j++) {
+    if (write(fd, more, strlen(more)) != (ssize_t) strlen(more)) die("write");
+  }
+  close(fd);
+  t = benchNow();
+  rows = editorReload();
+  printf("1000 rows added: %8.3f ms  (%d rows replaced)\n", (benchNow() - t) * 1e3, rows);
+  t = benchNow();
+  editorUndo();
+  printf("undo the reload: %8.3f ms  (%d rows)\n", (benchNow() - t) * 1e3, ECONFIG.numrows);
+
+  benchResetEditor();
+  unlink(path);
+}
+
+/* Write `lines` numbered lines to path, every line with a chance of 1 in `every` edited, deleted or doubled */
+void benchGenerateEdited(const char *path, long long lines, int every, unsigned seed) {
+  FILE *fp = fopen(path, "w");
+  if (!fp) die("fopen");
+  long long n;
+  srand(seed);
+  for (n = 0; n < lines; n++) {
+    int r = every > 0 ? rand() % every : 1;
+    if (r == 0) {
+      switch (rand() % 3) {
+        case 0: fprintf(fp, "%08lld edited by someone else\n", n); break;
+        case 1: break;
+        case 2: fprintf(fp, "%08lld line %lld of the file\n%08lld inserted\n", n, n * 7919 % 1000, n); break;
+      }
+    }
+    else {
+      fprintf(fp, "%08lld line %lld of the file\n", n, n * 7919 % 1000);
+    }
+  }
+  fclose(fp);
+}
+
+/* Compare a buffer of a million lines with edited copies of it, and reload one */
+void benchDiff(int argc, char **argv) {
+  long long lines = argc > 0 ? benchParseSize(argv[0]) : 1000000;
+  int changes = argc > 1 ? atoi(argv[1]) : 1000;
+  const char *path = "bench_diff.txt", *other = "bench_diff_other.txt";
+  double t;
+
+  benchGenerateEdited(path, lines, 0, 1);
+  benchResetEditor();
+  editorOpen((char *) path);
+  printf("%d rows\n", ECONFIG.numrows);
+
+  benchGenerateEdited(other, lines, changes > 0 ? lines / changes : 0, 2);
+  t = benchNow();
+  compareOpen(other);
+  printf("%d changes, hashing rows: %8.3f ms  (+%d -%d in %d hunks)\n", changes, (benchNow() - t) * 1e3,
+    ECONFIG.compare.added, ECONFIG.compare.removed, ECONFIG.compare.hunks);
+  t = benchNow();
+  compareOpen(other);
+  printf("%d changes, rows hashed:  %8.3f ms\n", changes, (benchNow() - t) * 1e3);
+
+  /* nothing in common, then the same lines in another order */
+  benchGenerateText(other, lines * 28, "%d unrelated %d %d %d\n");
+  t = benchNow();
+  compareOpen(other);
+  printf("unrelated file:          %8.3f ms  (%d hunks)\n", (benchNow() - t) * 1e3, ECONFIG.compare.hunks);
+  FILE *fp = fopen(other, "w");
+  if (!fp) die("fopen");
+  long long n;
+  for (n = 0; n < lines; n++) {
+    long long k = n * 48271 % lines;
+    fprintf(fp, "%08lld line %lld of the file\n", k, k * 7919 % 1000);
+  }
+  fclose(fp);
+  t = benchNow();
+  compareOpen(other);
+  printf("shuffled file:           %8.3f ms  (%d hunks)\n", (benchNow() - t) * 1e3, ECONFIG.compare.hunks);
+  compareClose();
+
+  benchGenerateEdited(path, lines, changes > 0 ? lines / changes : 0, 3);
+  t = benchNow();
+  int rows = editorReload();
+  printf("reload %d changes:       %8.3f ms  (%d rows replaced)\n", changes, (benchNow() - t) * 1e3, rows);
+
+  benchResetEditor();
+  unlink(path);
+  unlink(other);
+}
+
+/* Type on a line in the middle of path drawing a frame per key, every line or only the changed ones */
+void benchRedrawTyping(const char *label, const char *path, int keys, int full) {
+  struct appendbuffer ab = APPENDBUFFER_INIT;
+  long long bytes = 0;
+  int j;
+  benchResetEditor();
+  editorOpen((char *) path);
+  trigramDiscard();
+  ECONFIG.cy = ECONFIG.numrows / 2;
+  editorScroll();
+  drawRows(&ab);
+  double t = benchNow();
+  for (j = 0; j < keys; j++) {
+    if (j % 40 == 39) editorInsertNewLine();
+    else editorInsertChar('a' + j % 26);
+    ab.len = 0;
+    editorScroll();
+    if (full) editorScreenInvalidate();
+    drawRows(&ab);
+    bytes += ab.len;
+  }
+  printf("%-14s %8.3f ms/key  %7lld bytes/frame\n", label, (benchNow() - t) * 1e3 / keys, bytes / keys);
+  aBufferFree(&ab);
+}
+
+/* Terminal output per keystroke with the screen line tracking of drawRows() against full frames */
+void benchRedraw(int argc, char **argv) {
+  long long bytes = argc > 0 ? benchParseSize(argv[0]) : (64LL << 20);
+  int keys = argc > 1 ? atoi(argv[1]) : 2000;
+  const char *path = "bench_redraw.c";
+  benchGenerateText(path, bytes, "/* handler %d */\nstatic int handle%d(struct req *r, const char *name) {\n"
+    "  if (r->len > %d && name[0] != '\\0') return strlen(\"x\\n\") + 0x%x; // fast path\n}\n");
+  benchRedrawTyping("full frames", path, keys, 1);
+  benchRedrawTyping("changed lines", path, keys, 0);
+  benchResetEditor();
+  unlink(path);
+}
+
+struct {
+  const char *name;
+  const char *usage;
+  void (*run)(int argc, char **argv);
+} benchmarks[] = {
+  {"save", "[size=2G]", benchSave},
+  {"reload", "[size=64M]", benchReload},
+  {"regex", "[size=512M] [pattern]", benchRegex},
+  {"trigram", "[size=1G]", benchTrigram},
+  {"highlight", "[size=32M] [line=50M]", benchHighlight},
+  {"render", "[size=64M] [line=200M]", benchRender},
+  {"view", "[size=2G] [budget=64M]", benchView},
+  {"follow", "[size=1G]", benchFollow},
+  {"diff", "[lines=1M] [changes=1000]", benchDiff},
+  {"redraw", "[size=64M] [keys=2000]", benchRedraw},
+};
+
+int main(int argc, char *argv[]) {
+  unsigned int j;
+  benchResetEditor();
+  if (argc >= 2) {
+    for (j = 0; j < sizeof(benchmarks) / sizeof(benchmarks[0]); j++) {
+      if (strcmp(argv[1], benchmarks[j].name) == 0) {
+        benchmarks[j].run(argc - 2, argv + 2);
+        return 0;
+      }
+    }
+  }
+
+  fprintf(stderr, "usage: %s <benchmark> [args]\n", argv[0]);
+  for (j = 0; j < sizeof(benchmarks) / sizeof(benchmarks[0]); j++) {
+    fprintf(stderr, "  %s %s\n", benchmarks[j].name, benchmarks[j].usage);
+  }
+  return 1;
+}
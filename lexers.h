@@ -0,0 +1,936 @@
+/* Generated by lexgen.c, do not edit. */
+
+/* C: 2 conditions, 180 states, 45 byte classes */
+static const unsigned char lexCByteClass[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 2, 3, 0, 0, 0, 4, 0, 0, 5, 6, 0, 6, 7, 8,
+  9, 10, 11, 12, 13, 9, 14, 9, 15, 9, 0, 0, 0, 0, 0, 0,
+  0, 16, 16, 16, 16, 17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+  17, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 18, 0, 0, 19,
+  0, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+  35, 29, 36, 37, 38, 39, 40, 41, 42, 43, 44, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint16_t lexCNext[] = {
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 414, 414, 414, 414, 414, 414, 414,
+  460, 460, 92, 460, 460, 506, 552, 598, 644, 690, 736, 460, 782, 460, 460, 828,
+  460, 460, 874, 460, 920, 966, 1012, 1058, 1104, 1150, 460, 460, 460, 0, 1196, 1196,
+  1196, 1196, 1196, 1242, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 16, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 414, 414, 414, 414, 414, 414, 414, 460, 460, 92, 460,
+  460, 506, 552, 598, 644, 690, 736, 460, 782, 460, 460, 828, 460, 460, 874, 460,
+  920, 966, 1012, 1058, 1104, 1150, 460, 460, 460, 256, 92, 1288, 184, 230, 276, 92,
+  92, 322, 368, 414, 414, 414, 414, 414, 414, 414, 460, 460, 92, 460, 460, 506,
+  552, 598, 644, 690, 736, 460, 782, 460, 460, 828, 460, 460, 874, 460, 920, 966,
+  1012, 1058, 1104, 1150, 460, 460, 460, 256, 1334, 1334, 1380, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1426, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 1334, 1334, 260, 92, 1472, 184, 230, 276, 92, 92, 322, 368, 414,
+  414, 414, 414, 414, 414, 414, 460, 460, 92, 460, 1518, 1518, 1518, 1518, 1518, 1518,
+  1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+  1518, 1518, 1518, 258, 1564, 1564, 1564, 1564, 1610, 1564, 1564, 1564, 1564, 1564, 1564, 1564,
+  1564, 1564, 1564, 1564, 1564, 1564, 1656, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564,
+  1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564,
+  1564, 260, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1702, 1702, 1702, 1702, 1702,
+  1702, 1702, 460, 460, 92, 460, 460, 506, 552, 598, 644, 690, 736, 460, 782, 460,
+  460, 828, 460, 460, 874, 460, 920, 966, 1012, 1058, 1104, 1150, 460, 460, 460, 256,
+  92, 138, 184, 230, 276, 1748, 92, 322, 1794, 414, 414, 414, 414, 414, 414, 414,
+  460, 460, 92, 460, 460, 506, 552, 598, 644, 690, 736, 460, 782, 460, 460, 828,
+  460, 460, 874, 460, 920, 966, 1012, 1058, 1104, 1150, 460, 460, 460, 256, 92, 138,
+  184, 230, 276, 92, 92, 1840, 368, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1886,
+  92, 1840, 1840, 1840, 1840, 1840, 1886, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840,
+  1840, 1886, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 261, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1978, 1932, 2024, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 2070, 1932, 1932, 1932,
+  1932, 1932, 1932, 2116, 1932, 1932, 1932, 2162, 1932, 1932, 2208, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 2254, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2300, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 2346, 1932, 2392, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2438, 1932,
+  1932, 256, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 2484, 1932, 1932, 2530, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 2576, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2668,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2714, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 2760, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  2806, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 2852, 2898, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2944, 2990, 1932, 1932, 3036,
+  1932, 1932, 1932, 256, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 3082,
+  1932, 256, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 3128, 1932,
+  1932, 1932, 1932, 3174, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 3220, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 3266, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 256, 3312, 3312, 3312, 3312,
+  3312, 1242, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312,
+  3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312,
+  3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 273, 1196, 1196, 1196, 1196, 1196, 3358,
+  1196, 1196, 3404, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 273, 92, 1288, 184, 230, 276, 92, 92, 322,
+  368, 414, 414, 414, 414, 414, 414, 414, 460, 460, 92, 460, 460, 506, 552, 598,
+  644, 690, 736, 460, 782, 460, 460, 828, 460, 460, 874, 460, 920, 966, 1012, 1058,
+  1104, 1150, 460, 460, 460, 0, 1334, 1334, 1380, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1426, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 4, 92, 138, 184, 230, 276, 92, 92, 322, 368, 414, 414, 414,
+  414, 414, 414, 414, 460, 460, 92, 460, 460, 506, 552, 598, 644, 690, 736, 460,
+  782, 460, 460, 828, 460, 460, 874, 460, 920, 966, 1012, 1058, 1104, 1150, 460, 460,
+  460, 4, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 1334, 1426, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334,
+  1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 1334, 4,
+  92, 1472, 184, 230, 276, 92, 92, 322, 368, 414, 414, 414, 414, 414, 414, 414,
+  460, 460, 92, 460, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+  1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 2, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 414, 414, 414, 414, 414, 414, 414, 460, 460,
+  92, 460, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518,
+  1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 1518, 2, 1564, 1564, 1564, 1564,
+  1610, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1656, 1564,
+  1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564,
+  1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 4, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 414, 414, 414, 414, 414, 414, 414, 460, 460, 92, 460, 460, 506,
+  552, 598, 644, 690, 736, 460, 782, 460, 460, 828, 460, 460, 874, 460, 920, 966,
+  1012, 1058, 1104, 1150, 460, 460, 460, 4, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564,
+  1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1656, 1564, 1564, 1564, 1564, 1564,
+  1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564, 1564,
+  1564, 1564, 1564, 1564, 1564, 4, 92, 138, 184, 230, 276, 92, 92, 3450, 368, 3450,
+  3450, 3450, 3450, 3450, 3450, 3450, 3450, 3496, 92, 3450, 3450, 3450, 3450, 3450, 3496, 3450,
+  3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3496, 3450, 3450, 3450, 3450, 3450, 3450,
+  3450, 3450, 3450, 517, 1196, 1196, 1196, 1196, 1196, 1242, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 529, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542,
+  3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542,
+  3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 513,
+  92, 138, 184, 230, 276, 92, 92, 1840, 368, 1840, 1840, 1840, 1840, 1840, 1840, 1840,
+  1840, 1886, 92, 1840, 1840, 1840, 1840, 1840, 1886, 1840, 1840, 1840, 1840, 1840, 1840, 1840,
+  1840, 1840, 1840, 1886, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 5, 92, 138,
+  184, 230, 276, 92, 1840, 1840, 368, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1886,
+  92, 1840, 1840, 1840, 1840, 1840, 1886, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840,
+  1840, 1886, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 1840, 5, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 3588, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  3634, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 3680, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 3726, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 3772, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 3818, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 3864, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 92, 3910,
+  3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
+  3910, 3910, 3910, 3956, 3910, 3910, 3910, 3910, 3910, 514, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4002,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4048,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4094, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 4140, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 4186, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
+  92, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
+  3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 514, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4232, 1932, 1932, 1932, 1932,
+  1932, 1932, 4278, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4324, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 4370, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  4416, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4462, 4508, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 4554, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4600, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4646, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4692, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 4738, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 4784, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4830, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4876, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 4922, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 4968, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 5014, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  5060, 1932, 1932, 5106, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 5152, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  3312, 3312, 3312, 3312, 3312, 1242, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312,
+  3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312,
+  3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 3312, 17, 1196, 1196,
+  1196, 1196, 1196, 3358, 1196, 1196, 3404, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196,
+  1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 1196, 17, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 414, 414, 414, 414, 414, 414, 414, 460, 460, 92, 460,
+  460, 506, 552, 598, 644, 690, 736, 460, 782, 460, 460, 828, 460, 460, 874, 460,
+  920, 966, 1012, 1058, 1104, 1150, 460, 460, 460, 1, 92, 138, 184, 230, 276, 92,
+  92, 3450, 368, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3496, 92, 3450, 3450, 3450,
+  3450, 3450, 3496, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3496, 3450, 3450,
+  3450, 3450, 3450, 3450, 3450, 3450, 3450, 5, 92, 138, 184, 230, 276, 92, 3450, 3450,
+  368, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3496, 92, 3450, 3450, 3450, 3450, 3450,
+  3496, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3450, 3496, 3450, 3450, 3450, 3450,
+  3450, 3450, 3450, 3450, 3450, 5, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542,
+  3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542,
+  3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542, 3542,
+  3542, 3542, 3542, 1, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 5244, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 5290, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 5336,
+  5382, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 5428, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 512, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 5474, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 512, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 5520, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  5566, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 5612, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 3910,
+  5658, 3910, 5704, 3910, 5750, 5796, 3910, 3910, 92, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
+  3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
+  3910, 3910, 3910, 515, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 5198, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 5842, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 5888, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 5934, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 5980, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 6026, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 6072, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 6118, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  6164, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 6210, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 6256, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 6302, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 6348, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  6394, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 6440, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 6486, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 6532, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 6578,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
+  92, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910,
+  3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 3910, 515, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 6624, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 6670, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 6716, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 6762, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 6808, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 6854, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 512, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 6854, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 512, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 6854, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 512, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 6900, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 512, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 6946, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 6992, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  7038, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  5198, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  7084, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 7130, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 7176, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 7222, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 7268, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 7314, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 7360, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 7406, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 7452, 1932, 7498, 1932, 7544, 6854, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  7590, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 7636, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 7682, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 7728, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 6900, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 7774, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 7820, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  5198, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 7866, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 7912, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 6854, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 6854, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 6854, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 7958, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  8004, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 8050, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 8096, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 8142, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  5198, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322,
+  368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932,
+  1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 8188, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 8234, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 0, 92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+  92, 138, 184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138,
+  184, 230, 276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  92, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230,
+  276, 92, 92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932,
+  1932, 1932, 1932, 5198, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 0, 92, 138, 184, 230, 276, 92,
+  92, 322, 368, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 92, 1932, 1932, 1932,
+  1932, 1932, 2622, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932, 1932,
+  1932, 1932, 1932, 1932, 1932, 1932, 1932, 0,
+};
+static const uint16_t lexCStart[] = {
+  0, 46,
+};
+const struct lexTable lexC = {45, lexCByteClass, lexCNext, lexCStart};
+
+/* JSON: 1 conditions, 26 states, 18 byte classes */
+static const unsigned char lexJSONByteClass[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 3, 0, 4, 3, 0,
+  5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 0, 0, 0, 0, 0,
+  0, 6, 6, 6, 6, 7, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+  6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 0, 8, 0, 0, 0,
+  0, 9, 6, 6, 6, 10, 11, 6, 6, 6, 6, 6, 12, 6, 13, 6,
+  6, 6, 14, 15, 16, 17, 6, 6, 6, 6, 6, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint16_t lexJSONNext[] = {
+  19, 38, 57, 19, 76, 95, 114, 114, 19, 114, 114, 133, 114, 152, 114, 114,
+  171, 114, 0, 19, 38, 57, 19, 76, 95, 114, 114, 19, 114, 114, 133, 114,
+  152, 114, 114, 171, 114, 256, 19, 190, 57, 19, 76, 95, 114, 114, 19, 114,
+  114, 133, 114, 152, 114, 114, 171, 114, 256, 209, 209, 228, 209, 209, 209, 209,
+  209, 247, 209, 209, 209, 209, 209, 209, 209, 209, 209, 260, 19, 38, 57, 19,
+  76, 266, 114, 114, 19, 114, 114, 133, 114, 152, 114, 114, 171, 114, 256, 19,
+  38, 57, 285, 285, 285, 114, 285, 19, 114, 285, 133, 114, 152, 114, 114, 171,
+  114, 261, 19, 38, 57, 19, 76, 95, 304, 304, 19, 304, 304, 304, 304, 304,
+  304, 304, 304, 304, 256, 19, 38, 57, 19, 76, 95, 304, 304, 19, 323, 304,
+  304, 304, 304, 304, 304, 304, 304, 256, 19, 38, 57, 19, 76, 95, 304, 304,
+  19, 304, 304, 304, 304, 304, 304, 304, 304, 342, 256, 19, 38, 57, 19, 76,
+  95, 304, 304, 19, 304, 304, 304, 304, 304, 361, 304, 304, 304, 256, 19, 190,
+  57, 19, 76, 95, 114, 114, 19, 114, 114, 133, 114, 152, 114, 114, 171, 114,
+  0, 209, 209, 228, 209, 209, 209, 209, 209, 247, 209, 209, 209, 209, 209, 209,
+  209, 209, 209, 4, 19, 38, 57, 19, 76, 95, 114, 114, 19, 114, 114, 133,
+  114, 152, 114, 114, 171, 114, 4, 209, 209, 209, 209, 209, 209, 209, 209, 247,
+  209, 209, 209, 209, 209, 209, 209, 209, 209, 4, 19, 38, 57, 285, 285, 285,
+  114, 285, 19, 114, 285, 133, 114, 152, 114, 114, 171, 114, 517, 19, 38, 57,
+  285, 285, 285, 114, 285, 19, 114, 285, 133, 114, 152, 114, 114, 171, 114, 5,
+  19, 38, 57, 19, 76, 95, 304, 304, 19, 304, 304, 304, 304, 304, 304, 304,
+  304, 304, 0, 19, 38, 57, 19, 76, 95, 304, 304, 19, 304, 304, 304, 380,
+  304, 304, 304, 304, 304, 0, 19, 38, 57, 19, 76, 95, 304, 304, 19, 304,
+  304, 304, 399, 304, 304, 304, 304, 304, 0, 19, 38, 57, 19, 76, 95, 304,
+  304, 19, 304, 304, 304, 304, 304, 304, 304, 304, 418, 0, 19, 38, 57, 19,
+  76, 95, 304, 304, 19, 304, 304, 304, 304, 304, 304, 437, 304, 304, 0, 19,
+  38, 57, 19, 76, 95, 304, 304, 19, 304, 304, 304, 456, 304, 304, 304, 304,
+  304, 0, 19, 38, 57, 19, 76, 95, 304, 304, 19, 304, 456, 304, 304, 304,
+  304, 304, 304, 304, 0, 19, 38, 57, 19, 76, 95, 304, 304, 19, 304, 456,
+  304, 304, 304, 304, 304, 304, 304, 0, 19, 38, 57, 19, 76, 95, 475, 475,
+  19, 475, 475, 475, 475, 475, 475, 475, 475, 475, 514, 19, 38, 57, 19, 76,
+  95, 304, 304, 19, 304, 304, 304, 304, 304, 304, 304, 304, 304, 512,
+};
+static const uint16_t lexJSONStart[] = {
+  0,
+};
+const struct lexTable lexJSON = {18, lexJSONByteClass, lexJSONNext, lexJSONStart};
+
+/* YAML: 1 conditions, 46 states, 28 byte classes */
+static const unsigned char lexYAMLByteClass[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 2, 3, 4, 0, 0, 5, 6, 0, 0, 5, 7, 0, 8, 9, 10,
+  11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 12, 0, 0, 0, 0, 0,
+  0, 13, 13, 13, 13, 14, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+  13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 15, 0, 0, 13,
+  0, 16, 13, 13, 13, 17, 18, 13, 13, 13, 13, 13, 19, 13, 20, 21,
+  13, 13, 22, 23, 24, 25, 13, 13, 13, 26, 13, 0, 0, 0, 27, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint16_t lexYAMLNext[] = {
+  29, 58, 87, 116, 145, 87, 174, 29, 203, 232, 29, 261, 29, 290, 290, 29,
+  290, 290, 319, 290, 348, 377, 290, 290, 406, 290, 435, 464, 0, 29, 58, 87,
+  116, 145, 87, 174, 29, 203, 232, 29, 261, 29, 290, 290, 29, 290, 290, 319,
+  290, 348, 377, 290, 290, 406, 290, 435, 464, 256, 29, 493, 87, 116, 145, 87,
+  174, 29, 203, 232, 29, 261, 29, 290, 290, 29, 290, 290, 319, 290, 348, 377,
+  290, 290, 406, 290, 435, 464, 256, 29, 58, 522, 116, 145, 87, 174, 29, 522,
+  232, 522, 522, 29, 522, 522, 29, 522, 522, 522, 522, 522, 522, 522, 522, 522,
+  522, 522, 464, 259, 551, 551, 551, 580, 551, 551, 551, 551, 551, 551, 551, 551,
+  551, 551, 551, 609, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551,
+  260, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638,
+  638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 257, 667, 667,
+  667, 667, 667, 667, 696, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667,
+  667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 260, 29, 58, 87, 116, 145,
+  87, 174, 29, 725, 754, 29, 783, 29, 290, 290, 29, 290, 290, 319, 290, 348,
+  377, 290, 290, 406, 290, 435, 464, 256, 29, 58, 87, 116, 145, 87, 174, 29,
+  754, 812, 29, 261, 29, 290, 290, 29, 290, 290, 319, 290, 348, 377, 290, 290,
+  406, 290, 435, 464, 256, 29, 58, 87, 116, 145, 87, 174, 841, 870, 870, 29,
+  870, 899, 928, 870, 29, 928, 870, 928, 928, 928, 928, 928, 928, 928, 928, 928,
+  464, 261, 29, 58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957,
+  957, 29, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 464, 256, 29,
+  58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957, 957, 29, 986,
+  957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 464, 256, 29, 58, 87, 116,
+  145, 87, 174, 29, 957, 957, 29, 957, 899, 957, 957, 29, 957, 957, 957, 957,
+  957, 1015, 957, 957, 957, 1044, 957, 464, 256, 29, 58, 87, 116, 145, 87, 174,
+  29, 957, 957, 29, 957, 899, 957, 957, 29, 957, 957, 1073, 957, 1015, 957, 957,
+  957, 957, 957, 957, 464, 256, 29, 58, 87, 116, 145, 87, 174, 29, 957, 957,
+  29, 957, 899, 957, 957, 29, 957, 957, 957, 957, 957, 957, 1102, 957, 957, 957,
+  957, 464, 256, 29, 58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899,
+  957, 957, 29, 957, 1131, 957, 957, 957, 957, 957, 957, 957, 957, 957, 464, 256,
+  29, 58, 87, 116, 145, 87, 174, 29, 203, 232, 29, 261, 29, 290, 290, 29,
+  290, 290, 319, 290, 348, 377, 290, 290, 406, 290, 435, 464, 258, 29, 493, 87,
+  116, 145, 87, 174, 29, 203, 232, 29, 261, 29, 290, 290, 29, 290, 290, 319,
+  290, 348, 377, 290, 290, 406, 290, 435, 464, 0, 29, 58, 522, 116, 145, 87,
+  174, 29, 522, 232, 522, 522, 29, 522, 522, 29, 522, 522, 522, 522, 522, 522,
+  522, 522, 522, 522, 522, 464, 3, 551, 551, 551, 580, 551, 551, 551, 551, 551,
+  551, 551, 551, 551, 551, 551, 609, 551, 551, 551, 551, 551, 551, 551, 551, 551,
+  551, 551, 551, 4, 29, 58, 87, 116, 145, 87, 174, 29, 203, 232, 29, 261,
+  29, 290, 290, 29, 290, 290, 319, 290, 348, 377, 290, 290, 406, 290, 435, 464,
+  4, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551,
+  609, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 551, 4, 638, 638,
+  638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 638,
+  638, 638, 638, 638, 638, 638, 638, 638, 638, 638, 1, 667, 667, 667, 667, 667,
+  667, 696, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667, 667,
+  667, 667, 667, 667, 667, 667, 667, 4, 29, 58, 87, 116, 145, 87, 174, 29,
+  203, 232, 29, 261, 29, 290, 290, 29, 290, 290, 319, 290, 348, 377, 290, 290,
+  406, 290, 435, 464, 4, 29, 58, 87, 116, 145, 87, 174, 29, 1160, 754, 29,
+  261, 29, 290, 290, 29, 290, 290, 319, 290, 348, 377, 290, 290, 406, 290, 435,
+  464, 0, 29, 58, 87, 116, 145, 87, 174, 29, 754, 754, 29, 261, 29, 290,
+  290, 29, 290, 290, 319, 290, 348, 377, 290, 290, 406, 290, 435, 464, 0, 29,
+  58, 87, 116, 145, 87, 174, 841, 841, 841, 29, 841, 29, 290, 841, 29, 290,
+  841, 319, 290, 348, 377, 290, 290, 406, 290, 435, 464, 517, 29, 58, 87, 116,
+  145, 87, 174, 29, 754, 1160, 29, 261, 29, 290, 290, 29, 290, 290, 319, 290,
+  348, 377, 290, 290, 406, 290, 435, 464, 0, 29, 58, 87, 116, 145, 87, 174,
+  841, 841, 841, 29, 841, 29, 290, 841, 29, 290, 841, 319, 290, 348, 377, 290,
+  290, 406, 290, 435, 464, 5, 29, 58, 87, 116, 145, 87, 174, 841, 870, 870,
+  29, 870, 899, 928, 870, 29, 928, 870, 928, 928, 928, 928, 928, 928, 928, 928,
+  928, 464, 5, 29, 58, 87, 116, 145, 87, 174, 29, 203, 232, 29, 261, 29,
+  290, 290, 29, 290, 290, 319, 290, 348, 377, 290, 290, 406, 290, 435, 464, 515,
+  29, 58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957, 957, 29,
+  957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 464, 512, 29, 58, 87,
+  116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957, 957, 29, 957, 957, 957,
+  957, 957, 957, 957, 957, 957, 957, 957, 464, 0, 29, 58, 87, 116, 145, 87,
+  174, 29, 957, 957, 29, 957, 899, 957, 957, 29, 957, 957, 957, 1189, 957, 957,
+  957, 957, 957, 957, 957, 464, 0, 29, 58, 87, 116, 145, 87, 174, 29, 928,
+  928, 29, 928, 899, 928, 928, 29, 928, 928, 928, 928, 928, 928, 928, 928, 928,
+  928, 928, 464, 514, 29, 58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957,
+  899, 957, 957, 29, 957, 957, 957, 1218, 957, 957, 957, 957, 957, 957, 957, 464,
+  0, 29, 58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957, 957,
+  29, 957, 957, 1015, 957, 957, 957, 957, 957, 957, 957, 957, 464, 0, 29, 58,
+  87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957, 957, 29, 957, 957,
+  957, 957, 957, 957, 957, 957, 957, 1247, 957, 464, 0, 29, 58, 87, 116, 145,
+  87, 174, 29, 957, 957, 29, 957, 899, 957, 957, 29, 957, 957, 957, 957, 957,
+  957, 957, 1015, 957, 957, 957, 464, 0, 29, 58, 87, 116, 145, 87, 174, 29,
+  1276, 1276, 29, 261, 29, 290, 290, 29, 290, 290, 319, 290, 348, 377, 290, 290,
+  406, 290, 435, 464, 514, 29, 58, 87, 116, 145, 87, 174, 29, 957, 957, 29,
+  957, 899, 957, 957, 29, 957, 957, 957, 957, 957, 957, 957, 1305, 957, 957, 957,
+  464, 0, 29, 58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957,
+  957, 29, 957, 957, 957, 1015, 957, 957, 957, 957, 957, 957, 957, 464, 0, 29,
+  58, 87, 116, 145, 87, 174, 29, 957, 957, 29, 957, 899, 957, 957, 29, 957,
+  1015, 957, 957, 957, 957, 957, 957, 957, 957, 957, 464, 0, 29, 58, 87, 116,
+  145, 87, 174, 29, 754, 754, 29, 261, 29, 290, 290, 29, 290, 290, 319, 290,
+  348, 377, 290, 290, 406, 290, 435, 464, 512, 29, 58, 87, 116, 145, 87, 174,
+  29, 957, 957, 29, 957, 899, 957, 957, 29, 957, 1015, 957, 957, 957, 957, 957,
+  957, 957, 957, 957, 464, 0,
+};
+static const uint16_t lexYAMLStart[] = {
+  0,
+};
+const struct lexTable lexYAML = {28, lexYAMLByteClass, lexYAMLNext, lexYAMLStart};
+
+/* Shell: 3 conditions, 96 states, 32 byte classes */
+static const unsigned char lexShellByteClass[] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  1, 2, 3, 4, 5, 0, 0, 6, 0, 0, 2, 0, 0, 2, 0, 0,
+  7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 2,
+  2, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+  8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 9, 0, 0, 8,
+  0, 10, 11, 12, 13, 14, 15, 8, 16, 17, 8, 18, 19, 8, 20, 21,
+  22, 8, 23, 24, 25, 26, 8, 27, 28, 29, 8, 30, 0, 31, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+static const uint16_t lexShellNext[] = {
+  99, 132, 99, 165, 198, 231, 264, 297, 330, 99, 330, 363, 396, 429, 462, 495,
+  330, 528, 330, 561, 330, 330, 330, 594, 627, 660, 693, 726, 330, 330, 99, 99,
+  0, 759, 759, 759, 792, 759, 759, 759, 759, 759, 825, 759, 759, 759, 759, 759,
+  759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759,
+  759, 16, 858, 858, 858, 858, 858, 858, 891, 858, 858, 858, 858, 858, 858, 858,
+  858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858,
+  858, 858, 32, 99, 132, 99, 165, 198, 231, 264, 297, 330, 99, 330, 363, 396,
+  429, 462, 495, 330, 528, 330, 561, 330, 330, 330, 594, 627, 660, 693, 726, 330,
+  330, 99, 99, 256, 99, 924, 99, 165, 198, 231, 264, 297, 330, 99, 330, 363,
+  396, 429, 462, 495, 330, 528, 330, 561, 330, 330, 330, 594, 627, 660, 693, 726,
+  330, 330, 99, 99, 256, 759, 759, 759, 792, 759, 759, 759, 759, 759, 825, 759,
+  759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759, 759,
+  759, 759, 759, 759, 759, 276, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957,
+  957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957,
+  957, 957, 957, 957, 957, 957, 257, 99, 132, 990, 165, 990, 990, 264, 990, 1023,
+  99, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023, 1023,
+  1023, 1023, 1023, 1023, 1023, 1056, 99, 256, 858, 858, 858, 858, 858, 858, 891, 858,
+  858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858, 858,
+  858, 858, 858, 858, 858, 858, 858, 858, 292, 99, 132, 99, 165, 198, 231, 264,
+  1089, 330, 99, 330, 363, 396, 429, 462, 495, 330, 528, 330, 561, 330, 330, 330,
+  594, 627, 660, 693, 726, 330, 330, 99, 99, 261, 99, 132, 99, 165, 198, 231,
+  264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 256, 99, 132, 99, 165, 198,
+  231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1155, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 256, 99, 132, 99, 165,
+  198, 231, 264, 1122, 1122, 99, 1188, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1221, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 256, 99, 132, 99,
+  165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1254, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 256, 99, 132,
+  99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1287, 1122, 1122, 1122, 1122, 1320, 1122, 1122, 1122, 1353, 1122, 99, 99, 256, 99,
+  132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1386, 1122, 1122, 1122, 1419, 1122, 1122, 1122, 1122, 1452, 1122, 1122, 1122, 99, 99, 256,
+  99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1386,
+  1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99,
+  256, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1485, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99,
+  99, 256, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122,
+  1518, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  99, 99, 256, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122,
+  1122, 1122, 1122, 1551, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 99, 99, 256, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122,
+  1122, 1122, 1122, 1122, 1584, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 99, 99, 256, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1617, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 99, 99, 256, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99,
+  1122, 1122, 1122, 1122, 1122, 1122, 1650, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 99, 99, 256, 1683, 1683, 1683, 792, 1683, 1683, 1683, 1683, 1683,
+  1716, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683,
+  1683, 1683, 1683, 1683, 1683, 1683, 1683, 276, 99, 132, 99, 165, 198, 231, 264, 297,
+  330, 99, 330, 363, 396, 429, 462, 495, 330, 528, 330, 561, 330, 330, 330, 594,
+  627, 660, 693, 726, 330, 330, 99, 99, 260, 1683, 1683, 1683, 1683, 1683, 1683, 1683,
+  1683, 1683, 1716, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683,
+  1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 276, 1749, 1749, 1749, 1749, 1749, 1749,
+  891, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749,
+  1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 292, 99, 132, 99, 165, 198,
+  231, 264, 297, 330, 99, 330, 363, 396, 429, 462, 495, 330, 528, 330, 561, 330,
+  330, 330, 594, 627, 660, 693, 726, 330, 330, 99, 99, 260, 99, 924, 99, 165,
+  198, 231, 264, 297, 330, 99, 330, 363, 396, 429, 462, 495, 330, 528, 330, 561,
+  330, 330, 330, 594, 627, 660, 693, 726, 330, 330, 99, 99, 0, 957, 957, 957,
+  957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957,
+  957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 957, 1, 99, 132,
+  99, 165, 198, 231, 264, 297, 330, 99, 330, 363, 396, 429, 462, 495, 330, 528,
+  330, 561, 330, 330, 330, 594, 627, 660, 693, 726, 330, 330, 99, 99, 515, 99,
+  132, 99, 165, 198, 231, 264, 1782, 1782, 99, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
+  1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 99, 99, 515,
+  1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815,
+  1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1848,
+  515, 99, 132, 99, 165, 198, 231, 264, 1089, 330, 99, 330, 363, 396, 429, 462,
+  495, 330, 528, 330, 561, 330, 330, 330, 594, 627, 660, 693, 726, 330, 330, 99,
+  99, 5, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122,
+  1122, 1881, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1914, 1122, 1122, 1122,
+  1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1947, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1980, 1980, 99,
+  1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 2013, 1980, 1980, 1980, 1980, 1980,
+  1980, 1980, 1980, 1980, 99, 99, 514, 99, 132, 99, 165, 198, 231, 264, 1122, 1122,
+  99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2046, 1122, 1122, 1122, 1122, 1122, 1122, 2079,
+  1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122,
+  1122, 99, 2112, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264,
+  1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2145, 1122, 1122, 1122, 1122, 2178,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231,
+  264, 1980, 1980, 99, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980,
+  1980, 1980, 1980, 1980, 1980, 1980, 1980, 1980, 99, 99, 514, 99, 132, 99, 165, 198,
+  231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1386, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165,
+  198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  2211, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99,
+  165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 2244, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132,
+  99, 165, 198, 231, 264, 1122, 1122, 99, 2277, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 2310, 1122, 1122, 1122, 1122, 99, 99, 0, 99,
+  132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  2343, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0,
+  99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 2376, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99,
+  0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2409, 1122, 1122, 1122, 1122, 99,
+  99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 2442, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  99, 99, 0, 1683, 1683, 1683, 792, 1683, 1683, 1683, 1683, 1683, 1716, 1683, 1683, 1683,
+  1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683,
+  1683, 1683, 1683, 20, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1716, 1683, 1683,
+  1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683, 1683,
+  1683, 1683, 1683, 1683, 20, 1749, 1749, 1749, 1749, 1749, 1749, 891, 1749, 1749, 1749, 1749,
+  1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749, 1749,
+  1749, 1749, 1749, 1749, 1749, 36, 99, 132, 99, 165, 198, 231, 264, 1782, 1782, 99,
+  1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782, 1782,
+  1782, 1782, 1782, 1782, 99, 99, 3, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815,
+  1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815, 1815,
+  1815, 1815, 1815, 1815, 1815, 1815, 1848, 3, 99, 132, 99, 165, 198, 231, 264, 297,
+  330, 99, 330, 363, 396, 429, 462, 495, 330, 528, 330, 561, 330, 330, 330, 594,
+  627, 660, 693, 726, 330, 330, 99, 99, 3, 99, 132, 99, 165, 198, 231, 264,
+  1122, 1122, 99, 2475, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231,
+  264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198,
+  231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 2508, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165,
+  198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 512, 99, 132, 99,
+  165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 512, 99, 132,
+  99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1386, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99,
+  132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1386, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0,
+  99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1386, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99,
+  0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122, 1122, 99,
+  99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 2541, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 2574,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 2607, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122,
+  1122, 1122, 2640, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  2673, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122,
+  99, 1122, 1122, 1122, 1122, 1122, 2706, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122,
+  1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264,
+  1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2739, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231,
+  264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2772, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198,
+  231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1386, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165,
+  198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2805, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99,
+  165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 2838, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132,
+  99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 2871, 1122, 1122, 1122, 1122, 99, 99, 0, 99,
+  132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1386, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0,
+  99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 2904, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99,
+  0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2937, 1122, 1122, 1122, 1122, 1122, 1122, 99,
+  99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122, 1122,
+  99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122,
+  1122, 1122, 1386, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 2970, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122, 99,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1386,
+  1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122, 1122,
+  99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 3003, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264, 1122,
+  1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 3036, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231, 264,
+  1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1386, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198, 231,
+  264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 3069, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165, 198,
+  231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  3102, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99, 165,
+  198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 3135,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132, 99,
+  165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1386, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99, 132,
+  99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1386, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 99, 99, 0, 99,
+  132, 99, 165, 198, 231, 264, 1122, 1122, 99, 1122, 1122, 1122, 1122, 1122, 1122, 1122,
+  1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1122, 1386, 99, 99, 0,
+};
+static const uint16_t lexShellStart[] = {
+  0, 33, 66,
+};
+const struct lexTable lexShell = {32, lexShellByteClass, lexShellNext, lexShellStart};
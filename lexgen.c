@@ -0,0 +1,367 @@
+/*
+ * Generates lexers.h, the highlighting lexers. A language is a list of rules: a pattern
+ * in the find prompt's regex syntax, the highlight class of the tokens it matches and
+ * the start condition the lexer is in after them (conditions carry state across rows,
+ * like being inside a block comment). The rules of each condition are compiled with the
+ * editor's own regex code into one NFA and expanded into a full DFA, which is written
+ * out with the bytes folded into classes that no state tells apart.
+ *
+ * Earlier rules win ties, and every state past a start state must accept: then the
+ * longest token always ends where the DFA dies, and lexTotal() can send that transition
+ * on to the next token, so lexRow() reads every byte once. Patterns for unterminated
+ * strings and the like are written to accept every prefix.
+ * `make` rebuilds lexers.h when this file or main.c changes.
+ */
+#define EDITOR_LEXGEN
+#define main editorMain
+#include "main.c"
+#undef main
+
+struct lexRule {
+  int cond;
+  const char *pattern;
+  int hl;
+  int next; /* condition after the token */
+};
+
+struct lexLanguage {
+  const char *name; /* the table is called lex<name> */
+  struct lexRule *rules; /* ends with a NULL pattern */
+};
+
+#define STRING_BODY(q) q "([^" q "\\\\]|\\\\.?)*" q "?"
+
+/* conditions: 0 code, 1 inside a block comment */
+struct lexRule cRules[] = {
+  {0, "//.*", HL_COMMENT, 0},
+  {0, "/\\*", HL_COMMENT, 1},
+  {0, "/", HL_NORMAL, 0},
+  {0, STRING_BODY("\""), HL_STRING, 0},
+  {0, STRING_BODY("'"), HL_STRING, 0},
+  {0, "[0-9]([0-9A-Za-z_.]|[eEpP][-+])*", HL_NUMBER, 0},
+  {0, "\\.[0-9]([0-9A-Za-z_.]|[eEpP][-+])*", HL_NUMBER, 0},
+  {0, "\\.", HL_NORMAL, 0},
+  {0, "#[ \t]*[a-z]*", HL_KEYWORD1, 0},
+  {0, "(switch|if|while|for|break|continue|return|else|struct|union|typedef|static|enum|class|"
+      "case|default|do|goto|sizeof|const|extern|volatile|inline|register|restrict)", HL_KEYWORD1, 0},
+  {0, "(int|long|double|float|char|unsigned|signed|void|short|bool|size_t|ssize_t|off_t|"
+      "u?int(8|16|32|64)_t)", HL_KEYWORD2, 0},
+  {0, "[A-Za-z_][A-Za-z0-9_]*", HL_NORMAL, 0},
+  {0, "[ \t]+", HL_NORMAL, 0},
+  {1, "[^*]+", HL_COMMENT, 1},
+  {1, "\\*+", HL_COMMENT, 1},
+  {1, "\\*+/", HL_COMMENT, 0},
+  {0, NULL, 0, 0}
+};
+
+struct lexRule jsonRules[] = {
+  {0, STRING_BODY("\""), HL_STRING, 0},
+  {0, "-", HL_NORMAL, 0},
+  {0, "-?[0-9][0-9.eE+-]*", HL_NUMBER, 0},
+  {0, "(true|false|null)", HL_KEYWORD1, 0},
+  {0, "[A-Za-z]+", HL_NORMAL, 0},
+  {0, "[ \t]+", HL_NORMAL, 0},
+  {0, NULL, 0, 0}
+};
+
+struct lexRule yamlRules[] = {
+  {0, "#.*", HL_COMMENT, 0},
+  {0, STRING_BODY("\""), HL_STRING, 0},
+  {0, "'[^']*'?", HL_STRING, 0},
+  {0, "-?[0-9][0-9.eE+-]*", HL_NUMBER, 0},
+  {0, "(true|false|null|yes|no|on|off|~)", HL_KEYWORD1, 0},
+  {0, "(---|\\.\\.\\.)", HL_KEYWORD1, 0},
+  {0, "[-.]+", HL_NORMAL, 0},
+  {0, "[&*!][-A-Za-z0-9_!/]*", HL_KEYWORD2, 0},
+  {0, "[A-Za-z0-9_][-A-Za-z0-9_.]*", HL_NORMAL, 0},
+  {0, "[A-Za-z0-9_][-A-Za-z0-9_.]*:", HL_KEYWORD2, 0},
+  {0, "[ \t]+", HL_NORMAL, 0},
+  {0, NULL, 0, 0}
+};
+
+/* conditions: 0 code, 1 inside "...", 2 inside '...', quotes may span rows */
+struct lexRule shellRules[] = {
+  {0, "#.*", HL_COMMENT, 0},
+  {0, "\"", HL_STRING, 1},
+  {0, "'", HL_STRING, 2},
+  {0, "\\$", HL_NORMAL, 0},
+  {0, "\\$([A-Za-z_][A-Za-z0-9_]*|[#?$!@*0-9-])", HL_KEYWORD2, 0},
+  {0, "\\$\\{[^}]*\\}?", HL_KEYWORD2, 0},
+  {0, "(if|then|else|elif|fi|for|while|until|do|done|case|esac|in|function|return|"
+      "export|local|readonly|shift|exit|break|continue)", HL_KEYWORD1, 0},
+  {0, "[A-Za-z_][A-Za-z0-9_]*", HL_NORMAL, 0},
+  {0, "[0-9]+", HL_NUMBER, 0},
+  {0, "[ \t]+", HL_NORMAL, 0},
+  {1, "([^\"\\\\]|\\\\.?)+", HL_STRING, 1},
+  {1, "\"", HL_STRING, 0},
+  {2, "[^']+", HL_STRING, 2},
+  {2, "'", HL_STRING, 0},
+  {0, NULL, 0, 0}
+};
+
+struct lexLanguage languages[] = {
+  {"C", cRules},
+  {"JSON", jsonRules},
+  {"YAML", yamlRules},
+  {"Shell", shellRules},
+};
+
+/* Fully expanded DFA of one language, state 0 is the dead state */
+struct lexDFA {
+  int numstates;
+  int (*next)[256];
+  int *accept; /* highlight class + 1 | next condition << 4, 0 if not accepting */
+  int start[16];
+  int numconds;
+};
+
+int lexAddState(struct lexDFA *l) {
+  l->next = realloc(l->next, sizeof(*l->next) * (l->numstates + 1));
+  l->accept = realloc(l->accept, sizeof(int) * (l->numstates + 1));
+  memset(l->next[l->numstates], 0, sizeof(*l->next));
+  l->accept[l->numstates] = 0;
+  return l->numstates++;
+}
+
+/* Compile the rules of one condition into one program, a chain of splits into each rule */
+void lexCompileCondition(struct lexLanguage *lang, int cond, struct lexDFA *l) {
+  struct regex all;
+  int *rule = NULL; /* rule each instruction's RI_MATCH belongs to */
+  int numrules = 0, j, k;
+
+  memset(&all, 0, sizeof(all));
+  for (j = 0; lang->rules[j].pattern; j++) {
+    if (lang->rules[j].cond == cond) numrules++;
+  }
+  if (numrules == 0) return;
+  all.instcap = numrules;
+  all.insts[0] = malloc(sizeof(struct regexInst) * numrules);
+  all.numinsts[0] = numrules;
+
+  int numsets = 0, r = 0;
+  for (j = 0; lang->rules[j].pattern; j++) {
+    struct lexRule *rl = &lang->rules[j];
+    if (rl->cond != cond) continue;
+    const char *error;
+    struct regex *re = regexCompile(rl->pattern, &error);
+    if (re == NULL) {
+      fprintf(stderr, "lexgen: %s: %s: %s\n", lang->name, rl->pattern, error);
+      exit(1);
+    }
+    int base = all.numinsts[0], sets = 0;
+    for (k = 0; k < re->numinsts[0]; k++) {
+      if (re->insts[0][k].op == RI_CLASS && re->insts[0][k].x + 1 > sets) sets = re->insts[0][k].x + 1;
+    }
+    all.insts[0][r] = (struct regexInst) {r == numrules - 1 ? RI_JMP : RI_SPLIT, base, r + 1};
+    all.insts[0] = realloc(all.insts[0], sizeof(struct regexInst) * (base + re->numinsts[0]));
+    rule = realloc(rule, sizeof(int) * (base + re->numinsts[0]));
+    all.sets = realloc(all.sets, 32 * (numsets + sets + 1));
+    memcpy(all.sets[numsets], re->sets, 32 * sets);
+    for (k = 0; k < re->numinsts[0]; k++) {
+      struct regexInst inst = re->insts[0][k];
+      if (inst.op == RI_BEGIN || inst.op == RI_END) {
+        fprintf(stderr, "lexgen: %s: %s: anchors are not supported\n", lang->name, rl->pattern);
+        exit(1);
+      }
+      if (inst.op == RI_CLASS) inst.x += numsets;
+      if (inst.op == RI_SPLIT || inst.op == RI_JMP) {
+        inst.x += base;
+        inst.y += base;
+      }
+      all.insts[0][base + k] = inst;
+      rule[base + k] = j;
+    }
+    all.numinsts[0] += re->numinsts[0];
+    numsets += sets;
+    regexFree(re);
+    r++;
+  }
+
+  /* expand the lazy DFA breadth first, then number its live states after ours */
+  struct regexDFA d;
+  int s, c;
+  regexDFAInit(&d, &all, 0, 0);
+  int first = regexDFAStart(&d, 0);
+  unsigned flushes = d.flushes;
+  for (s = first; s < d.numstates; s++) {
+    for (c = 0; c < 256; c++) regexDFAStep(&d, s, c);
+    if (d.flushes != flushes) {
+      fprintf(stderr, "lexgen: %s: condition %d needs over %d states\n", lang->name, cond, EDITOR_REGEX_STATES);
+      exit(1);
+    }
+  }
+  int *map = malloc(sizeof(int) * d.numstates);
+  for (s = first; s < d.numstates; s++) {
+    map[s] = s != first && (d.flags[s] & REGEX_DEAD) ? 0 : lexAddState(l);
+  }
+  l->start[cond] = map[first];
+
+  for (s = first; s < d.numstates; s++) {
+    if (map[s] == 0) continue;
+    int best = -1;
+    for (k = d.setoff[s]; k < d.setoff[s + 1]; k++) {
+      int pc = d.pool[k];
+      if (d.insts[pc].op == RI_MATCH && (best == -1 || rule[pc] < best)) best = rule[pc];
+    }
+    if (s == first && best != -1) {
+      fprintf(stderr, "lexgen: %s: condition %d matches the empty string\n", lang->name, cond);
+      exit(1);
+    }
+    if (best != -1) l->accept[map[s]] = (lang->rules[best].hl + 1) | lang->rules[best].next << 4;
+    for (c = 0; c < 256; c++) {
+      int n = d.next[s * 256 + c];
+      if (n == first || (map[n] != 0 && !(d.flags[n] & REGEX_MATCH))) {
+        fprintf(stderr, "lexgen: %s: condition %d: a token prefix matches no rule\n", lang->name, cond);
+        exit(1);
+      }
+      l->next[map[s]][c] = map[n];
+    }
+  }
+
+  regexDFAFree(&d);
+  free(map);
+  free(rule);
+  free(all.insts[0]);
+  free(all.sets);
+}
+
+void lexPrintTable(const char *type, const char *name, int *v, int n) {
+  int j;
+  printf("static const %s %s[] = {", type, name);
+  for (j = 0; j < n; j++) printf("%s%d,", j % 16 ? " " : "\n  ", v[j]);
+  printf("\n};\n");
+}
+
+/* State for s entered as variant (0 continuing a token, 1 starting one, 2 recoloring it), added on first use */
+int lexTarget(struct lexDFA *l, struct lexDFA *t, int *map, int *work, int *nwork, int s, int variant) {
+  int key = s < 0 ? l->numstates * 3 - s - 1 : s * 3 + variant;
+  if (map[key] == -1) {
+    int value = s < 0 ? HL_NORMAL | (-s - 1) << 4 | LEX_FRESH : ((l->accept[s] & 15) - 1) | (l->accept[s] >> 4) << 4;
+    if (s >= 0 && variant == 1) value |= LEX_FRESH;
+    if (s >= 0 && variant == 2) value |= LEX_FIX;
+    map[key] = lexAddState(t);
+    t->accept[map[key]] = value;
+    work[(*nwork)++] = key;
+  }
+  return map[key];
+}
+
+/* Where byte c takes a lexer in condition cond that is between tokens */
+int lexRestart(struct lexDFA *l, struct lexDFA *t, int *map, int *work, int *nwork, int cond, int c) {
+  int s = l->next[l->start[cond]][c];
+  return s ? lexTarget(l, t, map, work, nwork, s, 1) : lexTarget(l, t, map, work, nwork, -cond - 1, 1);
+}
+
+/*
+ * Make the DFA total so lexRow() has no branch per token: where a token ends the next
+ * transition goes straight on as if from the start state, or to a state standing for a
+ * byte no rule starts with. States are split by how they are entered, which their value
+ * says: starting a token (LEX_FRESH), or continuing one whose class changes (LEX_FIX, as
+ * when "in" becomes the keyword "int"), the only case where earlier bytes are recolored.
+ */
+void lexTotal(struct lexDFA *l, struct lexDFA *t) {
+  int size = l->numstates * 3 + l->numconds;
+  int *map = malloc(sizeof(int) * size), *work = malloc(sizeof(int) * size), nwork = 0, done = 0;
+  int j, c;
+
+  memset(t, 0, sizeof(*t));
+  for (j = 0; j < size; j++) map[j] = -1;
+  t->numconds = l->numconds;
+  for (j = 0; j < l->numconds; j++) {
+    t->start[j] = lexAddState(t);
+    t->accept[t->start[j]] = j << 4;
+  }
+  for (j = 0; j < l->numconds; j++) {
+    for (c = 0; c < 256; c++) {
+      int to = lexRestart(l, t, map, work, &nwork, j, c); /* may move t->next */
+      t->next[t->start[j]][c] = to;
+    }
+  }
+  while (done < nwork) {
+    int key = work[done++];
+    int from = map[key];
+    if (key >= l->numstates * 3) {
+      for (c = 0; c < 256; c++) {
+        int to = lexRestart(l, t, map, work, &nwork, key - l->numstates * 3, c);
+        t->next[from][c] = to;
+      }
+      continue;
+    }
+    int s = key / 3;
+    for (c = 0; c < 256; c++) {
+      int to = l->next[s][c];
+      if (to == 0) {
+        to = lexRestart(l, t, map, work, &nwork, l->accept[s] >> 4, c);
+      }
+      else {
+        int variant = (l->accept[to] & 15) != (l->accept[s] & 15) ? 2 : 0;
+        to = lexTarget(l, t, map, work, &nwork, to, variant);
+      }
+      t->next[from][c] = to;
+    }
+  }
+  free(map);
+  free(work);
+}
+
+void lexGenerate(struct lexLanguage *lang) {
+  struct lexDFA l, t;
+  int j, s, c;
+  char name[64];
+
+  memset(&l, 0, sizeof(l));
+  lexAddState(&l); /* dead */
+  for (j = 0; lang->rules[j].pattern; j++) {
+    if (lang->rules[j].cond + 1 > l.numconds) l.numconds = lang->rules[j].cond + 1;
+  }
+  for (j = 0; j < l.numconds; j++) lexCompileCondition(lang, j, &l);
+  lexTotal(&l, &t);
+
+  /* bytes that every state treats alike share a class */
+  int byteclass[256], rep[256], numclasses = 0;
+  for (c = 0; c < 256; c++) {
+    for (j = 0; j < numclasses; j++) {
+      for (s = 0; s < t.numstates && t.next[s][c] == t.next[s][rep[j]]; s++);
+      if (s == t.numstates) break;
+    }
+    if (j == numclasses) rep[numclasses++] = c;
+    byteclass[c] = j;
+  }
+
+  /* a row per state: the transitions as offsets of the next row, then the state's value */
+  int width = numclasses + 1;
+  if (t.numstates * width > 65535) {
+    fprintf(stderr, "lexgen: %s: %d states of %d classes do not fit\n", lang->name, t.numstates, numclasses);
+    exit(1);
+  }
+  int *next = malloc(sizeof(int) * t.numstates * width);
+  for (s = 0; s < t.numstates; s++) {
+    for (j = 0; j < numclasses; j++) next[s * width + j] = t.next[s][rep[j]] * width;
+    next[s * width + numclasses] = t.accept[s];
+  }
+  int start[16];
+  for (j = 0; j < t.numconds; j++) start[j] = t.start[j] * width;
+
+  printf("\n/* %s: %d conditions, %d states, %d byte classes */\n", lang->name, t.numconds, t.numstates, numclasses);
+  snprintf(name, sizeof(name), "lex%sByteClass", lang->name);
+  lexPrintTable("unsigned char", name, byteclass, 256);
+  snprintf(name, sizeof(name), "lex%sNext", lang->name);
+  lexPrintTable("uint16_t", name, next, t.numstates * width);
+  snprintf(name, sizeof(name), "lex%sStart", lang->name);
+  lexPrintTable("uint16_t", name, start, t.numconds);
+  printf("const struct lexTable lex%s = {%d, lex%sByteClass, lex%sNext, lex%sStart};\n",
+    lang->name, numclasses, lang->name, lang->name, lang->name);
+
+  free(next);
+  free(l.next);
+  free(l.accept);
+  free(t.next);
+  free(t.accept);
+}
+
+int main() {
+  unsigned int j;
+  printf("/* Generated by lexgen.c, do not edit. */\n");
+  for (j = 0; j < sizeof(languages) / sizeof(languages[0]); j++) lexGenerate(&languages[j]);
+  return 0;
+}
@@ -14,10 +14,68 @@
 #include <time.h>
 #include <stdarg.h>
 #include <fcntl.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <stdint.h>
+#include <signal.h>
+#include <pthread.h>
+#include <limits.h>
+
+#if defined(__linux__) && !defined(EDITOR_NO_URING) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#ifdef IORING_FEAT_RW_CUR_POS /* from the same release as IORING_OP_READ and IORING_OP_WRITE */
+#define EDITOR_HAVE_URING
+#endif
+#endif
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#define EDITOR_HAVE_INOTIFY
+#endif
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#define EDITOR_HAVE_SSE2
+#endif
 
 #define EDITOR_VERSION "0.0.1"
 #define EDITOR_TAB_STOP 4
 #define EDITOR_QUIT_TIMES 3
+#define EDITOR_COLMARK_STEP 4096 /* chars between cx/rx checkpoints on long rows */
+#define EDITOR_IO_CHUNK (1 << 20) /* size of each read/write when loading or saving */
+#define EDITOR_IO_DEPTH 8 /* chunks kept in flight */
+#define EDITOR_JOURNAL_IDLE_MS 1000 /* idle time before buffered journal records are fsynced */
+#define EDITOR_JOURNAL_BATCH (64 << 10) /* buffered journal bytes that force a write */
+#define EDITOR_SEARCH_THREADS 8 /* most worker threads used by find-all */
+#define EDITOR_SEARCH_CHUNK 4096 /* rows a search worker claims at a time */
+#define EDITOR_REGEX_NODES 4096 /* parse tree limit, counted repetitions are expanded */
+#define EDITOR_REGEX_STATES 1024 /* cached DFA states before the cache is flushed */
+#define EDITOR_REGEX_LITERAL 32 /* longest required literal used to skip rows */
+#define EDITOR_TRIGRAM_MIN_SIZE (64LL << 20) /* smallest file that gets a trigram index */
+#define EDITOR_TRIGRAM_BLOCK (256 << 10) /* bytes of rows per index block */
+#define EDITOR_TRIGRAM_BITS 17 /* log2 of the filter bits per block */
+#define EDITOR_TRIGRAM_PROBES 16 /* most trigrams of a query looked up */
+#define EDITOR_HL_LOOKAHEAD 32 /* rows past the bottom of the screen highlighted ahead of time */
+#define EDITOR_HL_BUDGET (256 << 10) /* bytes of rows lexed per frame, the rest is left to the background */
+#define EDITOR_HL_AHEAD 1024 /* rows past the screen the background highlighter goes */
+#define EDITOR_HL_SLICE (64 << 10) /* bytes lexed between checks for cancellation */
+#define EDITOR_VIEW_MARK_LINES 1024 /* lines between offsets kept by the viewer's line index */
+#define EDITOR_VIEW_CHUNK (1 << 20) /* unit the viewer maps in and drops */
+#define EDITOR_VIEW_MEMORY (256 << 20) /* default resident budget of the viewer, override with FLY_VIEW_MEMORY */
+#define EDITOR_DIFF_COST 256 /* rounds a diff search takes before it settles for a good split over the best one */
+#define EDITOR_DIFF_SPLICE 16 /* hunks a reload moves the rows below for, more rebuild the row array */
+#define EDITOR_DIFF_CONTEXT 3 /* lines shown above a difference jumped to in the compare view */
+#define EDITOR_UNDO_LIMIT (64 << 20) /* default undo log budget, override with FLY_UNDO_LIMIT */
+#define EDITOR_UNDO_FILE_LIMIT (16 << 20) /* most undo history kept on disk per file */
+#define JOURNAL_MAGIC "FLYJRNL"
+#define JOURNAL_VERSION 1
+#define UNDO_FILE_MAGIC "FLYUNDO"
+#define UNDO_FILE_VERSION 1
+#define TRIGRAM_MAGIC "FLYTRGM"
+#define TRIGRAM_VERSION 1
+#define TRIGRAM_FILTER_BYTES ((1 << EDITOR_TRIGRAM_BITS) / 8)
 
 #define CTRL_KEY(k) ((k) & 0x1f) /* define ctrl+key keypresses by stripping bits for bitwise ANDs */
 
@@ -31,7 +89,44 @@ enum editorKey {
   HOME_KEY,
   END_KEY,
   PAGE_UP,
-  PAGE_DOWN
+  PAGE_DOWN,
+  PASTE_START,
+  PASTE_END
+};
+
+enum editorHighlight {
+  HL_NORMAL = 0,
+  HL_COMMENT,
+  HL_KEYWORD1,
+  HL_KEYWORD2,
+  HL_STRING,
+  HL_NUMBER,
+  HL_MATCH
+};
+
+/* Classes computed by the background highlighter, adopted by the main thread if still current */
+struct hlSlot {
+  unsigned version; /* row version they were computed for */
+  unsigned char in, out;
+  unsigned char *hl;
+};
+
+struct colMarks {
+  unsigned version; /* row version the checkpoints were taken for */
+  int count, total; /* taken so far, and the row's full set */
+  int mark[][3]; /* chars offset, render byte and screen column of each checkpoint */
+};
+
+enum colMarkField {
+  COLMARK_CX = 0,
+  COLMARK_RB,
+  COLMARK_COL
+};
+
+struct rowMatches {
+  unsigned version, query; /* row version and find query the spans were computed for */
+  int count;
+  int span[]; /* start and end render column of each match */
 };
 
 typedef struct editorRow {
@@ -39,21 +134,355 @@ typedef struct editorRow {
   int rsize;
   char *chars;
   char *render;
+  int ascii; /* chars has no byte >= 0x80, so render bytes are screen columns */
+  unsigned char *hl; /* highlight class of each render column, see editorHighlightRows() */
+  unsigned hl_version; /* version hl was computed for */
+  unsigned char hl_in, hl_out; /* lexer state at the start and at the end of the row */
+  struct hlSlot *hlslot; /* published by the background highlighter, atomic */
+  off_t disk_off; /* where this row starts in the file on disk, -1 if it was never saved */
+  int disk_len; /* length of the row on disk, excluding the newline */
+  int modified; /* chars no longer match the bytes at disk_off */
+  unsigned version; /* generation of chars, see editorRowModified() */
+  uint64_t hash; /* of chars, see editorRowHash() */
+  unsigned hash_version; /* version hash was computed for */
+  struct rowMatches *matches; /* cached find matches, see editorRowMatches() */
+  struct colMarks *colmarks; /* cx/rx checkpoints of long rows, see editorColMark() */
 } editorRow;
 
+#define LEX_FRESH 0x100 /* state value: the byte starts a token */
+#define LEX_FIX 0x200 /* state value: the token changed class, recolor it */
+
+/* DFA tables generated by lexgen.c, see lexRow() */
+struct lexTable {
+  int numclasses;
+  const unsigned char *byteclass;
+  const uint16_t *next; /* per state the offsets of the next state by byte class, then its value */
+  const uint16_t *start; /* offset of the start state of each condition */
+};
+
+struct editorSyntax {
+  const char *filetype;
+  const char **filematch; /* extensions starting with '.', or parts of the file name */
+  const struct lexTable *lexer;
+};
+
+enum journalOp {
+  JOURNAL_INSERT_ROW = 1, /* at, len, bytes */
+  JOURNAL_DEL_ROW, /* at */
+  JOURNAL_ROW_INSERT_CHAR, /* row, at, byte */
+  JOURNAL_ROW_DEL_CHAR, /* row, at */
+  JOURNAL_ROW_APPEND, /* row, len, bytes */
+  JOURNAL_ROW_TRUNCATE, /* row, size */
+  JOURNAL_INSERT_TEXT, /* row, col, len, bytes */
+  JOURNAL_DELETE_TEXT /* row, col, len */
+};
+
+/* Which version of which file on disk a sidecar file belongs to */
+struct fileIdentity {
+  uint64_t dev;
+  uint64_t ino;
+  uint64_t size;
+  int64_t mtime_sec;
+  int64_t mtime_nsec;
+};
+
+struct journalHeader {
+  char magic[8];
+  uint64_t version;
+  struct fileIdentity file;
+};
+
+struct editorJournal {
+  char *path; /* NULL while there's no file to journal for */
+  int fd; /* -1 until the first frame is written */
+  struct journalHeader base; /* identity of the file the records apply to */
+  char *buf; /* records not yet written */
+  size_t len, cap;
+  int unsynced; /* written but not fsynced */
+  int suspended; /* replaying, don't record */
+  long long lastedit;
+};
+
+enum undoType {
+  UNDO_INSERT = 1, /* text was inserted at (row, col) */
+  UNDO_DELETE, /* text was deleted from (row, col) */
+  UNDO_NEWROW /* an empty row was appended at row */
+};
+
+struct undoRecord {
+  uint32_t size; /* whole record including text and trailing size */
+  uint32_t group;
+  int32_t row, col;
+  uint32_t len;
+  uint32_t type;
+};
+
+struct undoFileHeader {
+  char magic[8];
+  uint64_t version;
+  struct fileIdentity file; /* the saved file the history leads up to */
+  uint64_t len; /* bytes of records that follow */
+  uint32_t checksum; /* of the records */
+  uint32_t reserved;
+};
+
+struct trigramHeader {
+  char magic[8];
+  uint64_t version;
+  struct fileIdentity file; /* the file the index was built from */
+  uint32_t numrows, numblocks;
+  uint32_t bits;
+  uint32_t reserved;
+};
+
+struct editorTrigram {
+  pthread_t thread;
+  int running; /* builder thread to join */
+  int cancel; /* atomic */
+  int ready; /* atomic, set once the index covers the buffer */
+  int numblocks;
+  int32_t *blockrow; /* first row of each block, plus the row count */
+  unsigned char *bits; /* one filter per block */
+  void *map; /* the index file when it was loaded from disk */
+  size_t maplen;
+  char *path;
+  struct fileIdentity file;
+};
+
+struct editorUndo {
+  char *buf;
+  size_t head, cur, tail, cap; /* [head, cur) can be undone, [cur, tail) redone */
+  size_t limit; /* bytes of log to keep */
+  uint32_t group; /* newest group */
+  int open; /* whether the next edit may join the newest group */
+  int endrow, endcol; /* where the text of the newest insert record ends */
+  struct fileIdentity origin; /* file the buffer was loaded from or last saved to, see editorCheckDisk() */
+  int history_checked; /* saved history was merged in, or can't be */
+  int bulk; /* records join the open group whatever their type, and are never merged */
+};
+
+enum regexOp {
+  RI_CLASS = 1, /* consume a byte in sets[x] */
+  RI_SPLIT, /* continue at both x and y */
+  RI_JMP, /* continue at x */
+  RI_MATCH,
+  RI_BEGIN, /* only at the start of the input */
+  RI_END /* only at the end of the input */
+};
+
+struct regexInst {
+  int op, x, y;
+};
+
+struct regex {
+  struct regexInst *insts[2]; /* the program, and the one matching reversed input */
+  int numinsts[2], instcap, building;
+  unsigned char (*sets)[32]; /* byte classes, one bit per byte */
+  char literal[EDITOR_REGEX_LITERAL]; /* every match contains this */
+  int literallen;
+};
+
+#define REGEX_MATCH 1
+#define REGEX_MATCHEND 2 /* matches if the input ends here */
+#define REGEX_DEAD 4
+
+struct regexDFA {
+  struct regex *re;
+  const struct regexInst *insts;
+  int numinsts, unanchored;
+  int numstates, statecap;
+  int *next; /* 256 transitions per state, -1 until first taken */
+  unsigned char *flags;
+  int *setoff, *pool, poollen, poolcap; /* instruction set of each state */
+  int *hash, hashcap;
+  int start[2]; /* start state in the middle / at the beginning of the input */
+  unsigned flushes;
+  unsigned *mark, gen; /* scratch for building sets */
+  int *stack, *list, *tmp;
+};
+
+/* What a search looks for: a plain string, or a regex when re is set */
+struct editorMatcher {
+  char *query;
+  size_t len;
+  struct regex *re;
+  struct regexDFA fwd, rev;
+  const char *scanned; /* row whose match starts are in starts */
+  int scannedsize;
+  unsigned char *starts;
+  int startscap;
+  int *ranges, numranges; /* rows that may match according to the trigram index, or NULL */
+};
+
+struct editorFind {
+  int active;
+  int row, col; /* current match, row is -1 when there is none */
+  int orig_cy, orig_cx, orig_rowoffset, orig_coloffset;
+  int regex; /* Ctrl-R in the prompt toggles it */
+  int highlight; /* show the matches of matcher on screen */
+  unsigned query; /* bumped when the matcher changes */
+  struct regex *re;
+  struct editorMatcher matcher;
+  char prompt[80];
+};
+
+struct searchMatch {
+  int row, col, len;
+};
+
+struct editorSearch {
+  char *query; /* NULL when there is no find-all */
+  struct regex *re; /* set for regex searches */
+  pthread_t thread[EDITOR_SEARCH_THREADS];
+  int nthreads; /* workers to join */
+  int numrows; /* rows when the search started */
+  int nextchunk; /* next chunk of rows to claim, atomic */
+  int cancel; /* atomic */
+  int running; /* workers still scanning, atomic */
+  pthread_mutex_t lock; /* guards pending */
+  struct searchMatch *pending; /* found but not yet collected by the main loop */
+  size_t npending, pendingcap;
+  struct searchMatch *matches; /* collected, in no particular order */
+  size_t nmatches, cap;
+  int done;
+};
+
+/* A row in the row index, an implicit treap ordered by row number */
+struct rowNode {
+  int left, right;
+  unsigned prio;
+  int size; /* rows in the subtree */
+  int delta; /* opening minus closing brackets in the row */
+  int dip; /* lowest nesting depth reached in the row, relative to its start, <= 0 */
+  int indent; /* columns of leading blanks, INT_MAX for blank rows */
+  int sumdelta, mindip, minindent; /* the same over the subtree, mindip relative to its start */
+  int foldlen; /* rows hidden by a fold starting at this row */
+  int cover; /* folds hiding this row */
+  int tag; /* cover still to be added to the children */
+  int lines; /* screen lines the row takes, more than one when soft wrapped */
+  int mincover, minlines, heads; /* lowest cover in the subtree, lines of the rows with it, fold starts */
+};
+
+struct editorRowIndex {
+  struct rowNode *nodes; /* nodes[0] is the empty tree */
+  int numnodes, cap, freelist;
+  int root;
+  int built; /* maintained only once something asked for it */
+  unsigned seed;
+};
+
+struct editorHighlighter {
+  pthread_t thread;
+  int started; /* thread to join */
+  int from, to; /* rows to lex */
+  int state; /* condition row `from` starts in */
+  const struct lexTable *lexer;
+  int cancel; /* atomic */
+  int running; /* atomic */
+  int published; /* slots filled since the last poll, atomic */
+};
+
+/* The file being viewed read-only, see viewOpen() */
+struct editorView {
+  int active;
+  int fd; /* kept open to notice the file growing */
+  int follow; /* keep up with appends, like tail -f */
+  int watch; /* inotify descriptor while following, -1 without one */
+  const char *map; /* the whole file, NULL when it is empty */
+  off_t size;
+  off_t *marks; /* start of every EDITOR_VIEW_MARK_LINES-th line */
+  long long nummarks, markcap;
+  off_t indexed; /* bytes scanned for line starts */
+  long long lines; /* newlines found in them */
+  off_t top; /* start of the first line on screen */
+  long long topline; /* its number, -1 until the index reaches it */
+  int coloffset;
+  off_t *starts; /* line starts on screen, for startstop and startsrows */
+  off_t startstop;
+  int startsrows;
+  size_t budget; /* bytes of the mapping kept resident */
+  unsigned char *touched; /* a bit per chunk of the mapping that may be resident */
+  off_t *ring; /* those chunks, oldest first */
+  int head, count, ringcap;
+};
+
+enum diffType {
+  DIFF_SAME = 0, /* a row of the buffer that is also in the file */
+  DIFF_OLD, /* a line only in the file */
+  DIFF_NEW /* a row only in the buffer */
+};
+
+/* A screen line of the compare view */
+struct diffLine {
+  int type;
+  int line; /* row of the buffer, or line of the file for DIFF_OLD */
+};
+
+/* The buffer compared with a file, see compareOpen() */
+struct editorCompare {
+  int active;
+  char *path;
+  char *map; /* the file, NULL when it is empty */
+  off_t size;
+  off_t *lineoff; /* line j is [lineoff[j], lineoff[j + 1]) */
+  int numlines;
+  struct diffLine *lines; /* both sides merged in order */
+  int numshown;
+  int top, coloffset;
+  int current; /* screen line of the change jumped to, where Enter goes */
+  int added, removed, hunks;
+};
+
+/* What a screen line showed at the last refresh, see drawRows() */
+struct screenLine {
+  unsigned version; /* of the row, 0 past the end of the buffer */
+  int at; /* first render byte, -1 on the welcome message */
+  int hl; /* lexer state the colors were computed from plus one, 0 if drawn without */
+  int hidden; /* folded rows in the marker */
+};
+
+struct editorScreen {
+  int rows; /* screen lines tracked */
+  struct screenLine *line;
+  uint64_t *dirty; /* bitmap of lines to draw again whatever they showed */
+  int coloffset, cols, wrap, highlight; /* what every line was drawn with */
+  unsigned query;
+  struct editorSyntax *syntax;
+};
+
 struct editorConfig {
   int cx, cy;
   int rx;
   int rowoffset;
+  int segoffset; /* wrapped segments of the rowoffset row above the screen */
   int coloffset;
   int screenrows;
   int screencols;
   int numrows;
   editorRow *row;
+  int wrap; /* soft wrap rows at the screen width instead of scrolling sideways */
+  int wrapcols; /* width the line counts in the row index were made for */
   int dirty;
+  unsigned generation; /* last row version given out, see editorRowModified() */
+  int savefrom; /* lowest row index touched since the last open/save */
+  off_t disk_size; /* file size as of the last open/save, -1 if unknown */
+  int diskwatch; /* inotify descriptor watching filename, -1 without one */
+  struct fileIdentity diskseen; /* last version of the file on disk the user was told about */
   char *filename;
+  struct editorSyntax *syntax; /* NULL when the file type is unknown */
+  int hlfrom; /* rows before this one are highlighted and start in the right state */
   char statusmsg[80];
   time_t statusmsg_time;
+  struct editorJournal journal;
+  struct editorUndo undo;
+  struct editorFind find;
+  struct editorSearch search;
+  struct editorTrigram trigram;
+  struct editorHighlighter highlighter;
+  struct editorRowIndex rowindex;
+  struct editorView view;
+  struct editorCompare compare;
+  struct editorScreen screen;
   struct termios old_termios;
 };
 
@@ -62,19 +491,74 @@ struct editorConfig ECONFIG;
 /*** prototypes ***/
 void editorSetStatusMessage(const char *fmt, ...);
 void refreshScreen();
-char *editorPrompt(char *prompt);
+char *editorPrompt(char *prompt, void (*callback)(char *, int));
+int editorConfirm(const char *msg);
+void editorIdle();
+void journalFlush(int sync);
+void journalRecord(int op, int a, int b, const char *s, size_t len);
+void journalRecordText(int op, int row, int col, const char *s, size_t len);
+void undoRecord(int type, int row, int col, const char *s, size_t len);
+void undoBreak();
+void undoLoadHistory();
+void editorBeginEdit();
+int editorIsASCII(const char *s, int n);
+void editorSanitizeRender(editorRow *row);
+int editorRenderChar(editorRow *row, int at, int *len);
+const int *editorColMark(editorRow *row, int field, int value);
+int editorRenderColumn(editorRow *row, int at);
+int editorRenderAt(editorRow *row, int col);
+int editorRenderFit(editorRow *row, int from, int cols);
+int editorRowPrevChar(editorRow *row, int at);
+int editorRowNextChar(editorRow *row, int at);
+void editorSelectSyntax();
+void searchClear();
+void hlStop();
+void rowIndexInsert(int at, int n);
+void rowIndexDelete(int at, int n);
+void rowIndexUpdate(int at);
+void rowIndexOpenFolds(int at, int n);
+void editorRevealRow(int at);
+int editorRowAfter(int at, int k);
+int editorRowsBetween(int from, int to);
+int editorNextRow(int at);
+int editorFoldsActive();
+void editorToggleWrap();
+void editorMoveLine(int d);
+void rowIndexRewrap();
+int rowIndexFoldLen(int at);
+void editorToggleFold();
+void editorMatchBracket();
+int hlPoll();
+void hlFreeSlot(struct hlSlot *slot);
+void trigramOpen(const char *filename, struct stat *st);
+void trigramDiscard();
+void trigramDrop();
+int *trigramCandidates(const char *s, size_t len, int *numranges);
+void searchPublish(struct editorSearch *s, struct searchMatch *m, int n);
+int searchPoll();
+int viewPoll();
+int editorCheckDisk();
+void editorWatchFile();
+int editorDiskUnchanged(struct stat *st);
+void diffRowsWithFile(const char *map, const off_t *lineoff, int numlines, unsigned char *changedrows, unsigned char *changedlines);
+struct appendbuffer;
+void aBufferAppend(struct appendbuffer *ab, const char *s, int len);
 
 /* Handles errors and exits the program */
 void die(const char *s) {
   write(STDOUT_FILENO, "\x1b[2J", 4); /* clear the screen */
   write(STDOUT_FILENO, "\x1b[H", 3); /* position cursor at top left */
 
+  int saved = errno;
+  journalFlush(1);
+  errno = saved;
   perror(s); /* read global errno value and print error message */
   exit(1);
 }
 
 /* Restore to old I/O settings */
 void resetTermios() {
+  write(STDOUT_FILENO, "\x1b[?2004l", 8); /* disable bracketed paste */
   if (tcsetattr(0, TCSAFLUSH, &ECONFIG.old_termios) == -1) {
  die("tcsetattr");
   }
@@ -93,14 +577,16 @@ void initTermios() {
   new.c_cc[VTIME] = 1;
 
   if (tcsetattr(0, TCSAFLUSH, &new) == -1) die("tcsetattr"); /* use the new I/O settings */
+  write(STDOUT_FILENO, "\x1b[?2004h", 8); /* enable bracketed paste so pastes arrive as one block */
 }
 
 int readKey() {
   int readReturnVal;
-  char c;
+  unsigned char c;
 
   while ((readReturnVal = read(STDIN_FILENO, &c, 1)) != 1) {
  if (readReturnVal == -1 && errno != EAGAIN) die("read");
+    editorIdle();
   }
   
   if (c == '\x1b') {
@@ -123,6 +609,13 @@ int readKey() {
             case '8': return END_KEY;
           }
         }
+        else if (seq[1] == '2' && seq[2] == '0') {
+          char tail[2];
+          if (read(STDIN_FILENO, &tail[0], 1) != 1) return '\x1b';
+          if (read(STDIN_FILENO, &tail[1], 1) != 1) return '\x1b';
+          if (tail[1] == '~' && tail[0] == '0') return PASTE_START;
+          if (tail[1] == '~' && tail[0] == '1') return PASTE_END;
+        }
       }
       else {
         switch (seq[1]) {
@@ -175,219 +668,5819 @@ int getWindowSize(int *rows, int *cols) {
     if (write(STDOUT_FILENO, "\x1b[999C\x1b[999B", 12) != 12) return -1;
     return getCursorPosition(rows, cols);
   }
-  else {
-    *cols = ws.ws_col;
-    *rows = ws.ws_row;
+  else {
+    *cols = ws.ws_col;
+    *rows = ws.ws_row;
+    return 0;
+  }
+}
+
+/* Tabs and other control characters are the bytes that do not render as themselves */
+int editorIsSpecial(char c) {
+  return (unsigned char) c < 0x20 || c == 0x7f;
+}
+
+/* Render bytes that c takes when it lands at render offset rx: tabs run to the next stop, control characters show as ^X */
+int editorRenderStep(char c, int rx) {
+  if (c == '\t') return EDITOR_TAB_STOP - rx % EDITOR_TAB_STOP;
+  return editorIsSpecial(c) ? 2 : 1;
+}
+
+int editorRowCxToRx(editorRow *row, int cx) {
+  const int *m = editorColMark(row, COLMARK_CX, cx);
+  int rx = m[COLMARK_RB];
+  int j;
+  for (j = m[COLMARK_CX]; j < cx; j++) {
+    rx += editorRenderStep(row->chars[j], rx);
+  }
+  return row->ascii ? rx : editorRenderColumn(row, rx);
+}
+
+int editorRowRxToCx(editorRow *row, int rx) {
+  if (!row->ascii) rx = editorRenderAt(row, rx);
+  const int *m = editorColMark(row, COLMARK_RB, rx);
+  int cur = m[COLMARK_RB];
+  int cx;
+  for (cx = m[COLMARK_CX]; cx < row->size; cx++) {
+    cur += editorRenderStep(row->chars[cx], cur);
+    if (cur > rx) return cx;
+  }
+  return cx;
+}
+
+/* End of the wrapped segment of row starting at render offset from: after the last blank that fits, or at the width */
+int editorWrapEnd(editorRow *row, int from) {
+  int width = ECONFIG.screencols > 0 ? ECONFIG.screencols : 1;
+  int fit = editorRenderFit(row, from, width), len;
+  if (fit == row->rsize) return fit;
+  if (fit == from) {
+    editorRenderChar(row, from, &len); /* wider than the screen */
+    return from + len;
+  }
+  int j = fit;
+  while (j > from && row->render[j - 1] != ' ') j--;
+  return j > from ? j : fit;
+}
+
+int editorWrapCount(editorRow *row) {
+  int n = 1, at = 0;
+  while ((at = editorWrapEnd(row, at)) < row->rsize) n++;
+  return n;
+}
+
+/* Segment of row that screen column rx is in, *start set to the column it begins at */
+int editorWrapSegment(editorRow *row, int rx, int *start) {
+  int seg = 0, at = 0, end;
+  int rb = editorRenderAt(row, rx);
+  while ((end = editorWrapEnd(row, at)) < row->rsize && rb >= end) {
+    at = end;
+    seg++;
+  }
+  *start = editorRenderColumn(row, at);
+  return seg;
+}
+
+/* Write the rendering of special byte c at render[idx], returns the new idx */
+int editorRenderSpecial(char c, char *render, int idx) {
+  if (c == '\t') {
+    render[idx++] = ' ';
+    while (idx % EDITOR_TAB_STOP != 0) render[idx++] = ' ';
+  }
+  else {
+    render[idx++] = '^';
+    render[idx++] = c ^ 0x40; /* ^@ to ^_, and ^? for DEL */
+  }
+  return idx;
+}
+
+void editorRenderRowScalar(editorRow *row) {
+  int tabs = 0, controls = 0;
+  int j;
+  for (j = 0; j < row->size; j++) {
+    if (row->chars[j] == '\t') tabs++;
+    else if (editorIsSpecial(row->chars[j])) controls++;
+  }
+
+  free(row->render);
+  row->render = malloc(row->size + tabs*(EDITOR_TAB_STOP - 1) + controls + 1);
+
+  int idx = 0;
+  for (j = 0; j < row->size; j++) {
+    if (editorIsSpecial(row->chars[j])) {
+      idx = editorRenderSpecial(row->chars[j], row->render, idx);
+    }
+    else {
+      row->render[idx++] = row->chars[j];
+    }
+  }
+  row->render[idx] = '\0';
+  row->rsize = idx;
+  row->ascii = editorIsASCII(row->chars, row->size);
+}
+
+#ifdef EDITOR_HAVE_SSE2
+/* Special bytes among s[0..32) as a bit mask, *tabs set to the tabs among them and *high to the bytes >= 0x80 */
+unsigned editorSpecialMask(const char *s, unsigned *tabs, unsigned *high) {
+  __m128i lo = _mm_loadu_si128((const __m128i *) s);
+  __m128i hi = _mm_loadu_si128((const __m128i *) &s[16]);
+  __m128i c1f = _mm_set1_epi8(0x1f), del = _mm_set1_epi8(0x7f), tab = _mm_set1_epi8('\t');
+  /* max(b, 0x1f) == 0x1f is an unsigned b <= 0x1f */
+  __m128i slo = _mm_or_si128(_mm_cmpeq_epi8(_mm_max_epu8(lo, c1f), c1f), _mm_cmpeq_epi8(lo, del));
+  __m128i shi = _mm_or_si128(_mm_cmpeq_epi8(_mm_max_epu8(hi, c1f), c1f), _mm_cmpeq_epi8(hi, del));
+  *tabs = (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(lo, tab)) | (unsigned) _mm_movemask_epi8(_mm_cmpeq_epi8(hi, tab)) << 16;
+  *high = (unsigned) _mm_movemask_epi8(lo) | (unsigned) _mm_movemask_epi8(hi) << 16;
+  return (unsigned) _mm_movemask_epi8(slo) | (unsigned) _mm_movemask_epi8(shi) << 16;
+}
+
+/*
+ * Same result as editorRenderRowScalar(), 32 bytes at a time: one pass sizes the
+ * render from the special and tab counts, the second copies the runs between special
+ * bytes with memcpy and expands only the special bytes themselves.
+ */
+void editorRenderRowSSE2(editorRow *row) {
+  const char *s = row->chars;
+  int n = row->size, i, j, specials = 0, tabs = 0;
+  unsigned tabmask, high, anyhigh = 0;
+
+  for (i = 0; i + 32 <= n; i += 32) {
+    specials += __builtin_popcount(editorSpecialMask(&s[i], &tabmask, &high));
+    tabs += __builtin_popcount(tabmask);
+    anyhigh |= high;
+  }
+  for (j = i; j < n; j++) {
+    specials += editorIsSpecial(s[j]);
+    tabs += s[j] == '\t';
+    anyhigh |= s[j] & 0x80;
+  }
+
+  free(row->render);
+  char *render = row->render = malloc(n + tabs * (EDITOR_TAB_STOP - 1) + (specials - tabs) + 1);
+  int idx = 0, last = 0;
+  if (specials > 0) {
+    for (i = 0; i + 32 <= n; i += 32) {
+      unsigned mask = editorSpecialMask(&s[i], &tabmask, &high);
+      while (mask) {
+        j = i + __builtin_ctz(mask);
+        memcpy(&render[idx], &s[last], j - last);
+        idx = editorRenderSpecial(s[j], render, idx + j - last);
+        last = j + 1;
+        mask &= mask - 1;
+      }
+    }
+    for (j = i; j < n; j++) {
+      if (!editorIsSpecial(s[j])) continue;
+      memcpy(&render[idx], &s[last], j - last);
+      idx = editorRenderSpecial(s[j], render, idx + j - last);
+      last = j + 1;
+    }
+  }
+  memcpy(&render[idx], &s[last], n - last);
+  idx += n - last;
+  render[idx] = '\0';
+  row->rsize = idx;
+  row->ascii = anyhigh == 0;
+}
+#endif
+
+void editorUpdateRow(editorRow *row) {
+#ifdef EDITOR_HAVE_SSE2
+  editorRenderRowSSE2(row);
+#else
+  editorRenderRowScalar(row);
+#endif
+  if (!row->ascii) editorSanitizeRender(row);
+
+  if (ECONFIG.rowindex.built && row >= ECONFIG.row && row < ECONFIG.row + ECONFIG.numrows) {
+    rowIndexUpdate(row - ECONFIG.row);
+  }
+}
+
+/* Called before any change to the rows: background readers must be out of the way */
+void editorBeginEdit() {
+  if (ECONFIG.search.query) searchClear();
+  if (ECONFIG.trigram.path) trigramDiscard();
+  if (ECONFIG.highlighter.started) hlStop();
+}
+
+/* Remember that rows from `at` onwards may no longer sit where they are on disk, nor lex the same */
+void editorTouchRows(int at) {
+  if (at < ECONFIG.savefrom) ECONFIG.savefrom = at;
+  if (at < ECONFIG.hlfrom) ECONFIG.hlfrom = at;
+}
+
+/*
+ * Every change to a row's chars, and every new row, takes the next ECONFIG.generation as
+ * the row's version. A version is never given out twice, so whatever is cached for one
+ * (colors, find matches, checkpoints, the hash, what a screen line shows) stays valid
+ * exactly as long as the version is equal, even across rows that were moved or replaced.
+ */
+void editorRowModified(editorRow *row) {
+  row->modified = 1;
+  row->version = ++ECONFIG.generation;
+  editorTouchRows(row - ECONFIG.row);
+}
+
+/* Fill in a new empty row, chars are left for the caller */
+void editorInitRow(editorRow *row) {
+  row->size = 0;
+  row->chars = NULL;
+  row->rsize = 0;
+  row->render = NULL;
+  row->ascii = 1;
+  row->hl = NULL;
+  row->hl_version = ~0u;
+  row->hl_in = row->hl_out = 0;
+  row->hlslot = NULL;
+  row->disk_off = -1;
+  row->disk_len = 0;
+  row->modified = 1;
+  row->version = ++ECONFIG.generation;
+  row->hash_version = ~0u;
+  row->matches = NULL;
+  row->colmarks = NULL;
+}
+
+uint64_t editorRotl64(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+
+/* 64-bit hash, the short input rounds and the final mix of xxHash64 */
+uint64_t editorHash64(const char *s, size_t len) {
+  const uint64_t p1 = 0x9E3779B185EBCA87ULL, p2 = 0xC2B2AE3D27D4EB4FULL, p3 = 0x165667B19E3779F9ULL;
+  const uint64_t p4 = 0x85EBCA77C2B2AE63ULL, p5 = 0x27D4EB2F165667C5ULL;
+  uint64_t h = p5 + len, w;
+  uint32_t v;
+  while (len >= 8) {
+    memcpy(&w, s, 8);
+    h ^= editorRotl64(w * p2, 31) * p1;
+    h = editorRotl64(h, 27) * p1 + p4;
+    s += 8;
+    len -= 8;
+  }
+  if (len >= 4) {
+    memcpy(&v, s, 4);
+    h ^= v * p1;
+    h = editorRotl64(h, 23) * p2 + p3;
+    s += 4;
+    len -= 4;
+  }
+  while (len-- > 0) {
+    h ^= (unsigned char) *s++ * p5;
+    h = editorRotl64(h, 11) * p1;
+  }
+  h ^= h >> 33;
+  h *= p2;
+  h ^= h >> 29;
+  h *= p3;
+  h ^= h >> 32;
+  return h;
+}
+
+/* Hash of a row's chars, cached until the row changes */
+uint64_t editorRowHash(editorRow *row) {
+  if (row->hash_version != row->version) {
+    row->hash = editorHash64(row->chars, row->size);
+    row->hash_version = row->version;
+  }
+  return row->hash;
+}
+
+/* Make room for n new rows at `at` with a single memmove, chars are left for the caller */
+void editorOpenRows(int at, int n) {
+  ECONFIG.row = realloc(ECONFIG.row, sizeof(editorRow) * (ECONFIG.numrows + n));
+  memmove(&ECONFIG.row[at + n], &ECONFIG.row[at], sizeof(editorRow) * (ECONFIG.numrows - at));
+
+  int j;
+  for (j = at; j < at + n; j++) editorInitRow(&ECONFIG.row[j]);
+  ECONFIG.numrows += n;
+  if (ECONFIG.rowindex.built) rowIndexInsert(at, n);
+}
+
+void editorInsertRow(int at, char *s, size_t len) {
+  if (at < 0 || at > ECONFIG.numrows) return;
+  editorBeginEdit();
+  journalRecord(JOURNAL_INSERT_ROW, at, len, s, len);
+  editorTouchRows(at);
+  editorOpenRows(at, 1);
+
+  ECONFIG.row[at].size = len;
+  ECONFIG.row[at].chars = malloc(len + 1);
+  memcpy(ECONFIG.row[at].chars, s, len);
+  ECONFIG.row[at].chars[len] = '\0';
+  editorUpdateRow(&ECONFIG.row[at]);
+
+  ECONFIG.dirty++;
+}
+
+void editorFreeRow(editorRow *row) {
+  free(row->matches);
+  free(row->colmarks);
+  free(row->hl);
+  hlFreeSlot(row->hlslot);
+  free(row->render);
+  free(row->chars);
+}
+
+void editorDelRow(int at) {
+  if (at < 0 || at >= ECONFIG.numrows) return;
+  editorBeginEdit();
+  journalRecord(JOURNAL_DEL_ROW, at, 0, NULL, 0);
+  editorTouchRows(at);
+  editorFreeRow(&ECONFIG.row[at]);
+  memmove(&ECONFIG.row[at], &ECONFIG.row[at + 1], sizeof(editorRow) * (ECONFIG.numrows - at - 1));
+  ECONFIG.numrows--;
+  if (ECONFIG.rowindex.built) rowIndexDelete(at, 1);
+  ECONFIG.dirty++;
+}
+
+void editorRowInsertChar(editorRow *row, int at, int c) {
+  if (at < 0 || at > row->size) at = row->size;
+  editorBeginEdit();
+  char ch = c;
+  journalRecord(JOURNAL_ROW_INSERT_CHAR, row - ECONFIG.row, at, &ch, 1);
+  row->chars = realloc(row->chars, row->size + 2);
+  memmove(&row->chars[at + 1], &row->chars[at], row->size - at + 1);
+  row->size++;
+  row->chars[at] = c;
+  editorRowModified(row);
+  editorUpdateRow(row);
+  ECONFIG.dirty++;
+}
+
+void editorRowAppendString(editorRow *row, char *s, size_t len) {
+  editorBeginEdit();
+  journalRecord(JOURNAL_ROW_APPEND, row - ECONFIG.row, len, s, len);
+  row->chars = realloc(row->chars, row->size + len + 1);
+  memcpy(&row->chars[row->size], s, len);
+  row->size += len;
+  row->chars[row->size] = '\0';
+  editorRowModified(row);
+  editorUpdateRow(row);
+  ECONFIG.dirty++;
+}
+
+void editorRowDelChar(editorRow *row, int at) {
+  if (at < 0 || at >= row->size) return;
+  editorBeginEdit();
+  journalRecord(JOURNAL_ROW_DEL_CHAR, row - ECONFIG.row, at, NULL, 0);
+  memmove(&row->chars[at], &row->chars[at + 1], row->size - at);
+  row->size--;
+  editorRowModified(row);
+  editorUpdateRow(row);
+  ECONFIG.dirty++;
+}
+
+void editorRowTruncate(editorRow *row, int size) {
+  if (size < 0 || size > row->size) return;
+  editorBeginEdit();
+  journalRecord(JOURNAL_ROW_TRUNCATE, row - ECONFIG.row, size, NULL, 0);
+  row->size = size;
+  row->chars[size] = '\0';
+  editorRowModified(row);
+  editorUpdateRow(row);
+  ECONFIG.dirty++;
+}
+
+/*
+ * Text-level edits used for bulk changes (undo/redo, paste). A '\n' in the text is a row
+ * break, and however many rows are involved the row array is moved only once.
+ */
+void editorInsertText(int at, int col, const char *s, size_t len, int *endrow, int *endcol) {
+  if (at < 0 || at >= ECONFIG.numrows) return;
+  editorRow *row = &ECONFIG.row[at];
+  if (col < 0 || col > row->size) col = row->size;
+  editorBeginEdit();
+  journalRecordText(JOURNAL_INSERT_TEXT, at, col, s, len);
+  editorTouchRows(at);
+
+  const char *end = s + len;
+  const char *nl = memchr(s, '\n', len);
+  int er = at, ec;
+  if (nl == NULL) {
+    row->chars = realloc(row->chars, row->size + len + 1);
+    memmove(&row->chars[col + len], &row->chars[col], row->size - col + 1);
+    memcpy(&row->chars[col], s, len);
+    row->size += len;
+    ec = col + len;
+  }
+  else {
+    int n = 0;
+    const char *p;
+    for (p = nl; p != NULL; p = memchr(p + 1, '\n', end - p - 1)) n++;
+
+    editorOpenRows(at + 1, n);
+    row = &ECONFIG.row[at];
+
+    /* rows after the first newline, the last one takes over the tail of the split row */
+    int taillen = row->size - col;
+    p = nl + 1;
+    int i;
+    for (i = 1; i <= n; i++) {
+      const char *q = (i < n) ? memchr(p, '\n', end - p) : end;
+      editorRow *r = &ECONFIG.row[at + i];
+      r->size = (q - p) + (i == n ? taillen : 0);
+      r->chars = malloc(r->size + 1);
+      memcpy(r->chars, p, q - p);
+      if (i == n) memcpy(&r->chars[q - p], &row->chars[col], taillen);
+      r->chars[r->size] = '\0';
+      editorUpdateRow(r);
+      ec = q - p;
+      p = q + 1;
+    }
+    er = at + n;
+
+    row->chars = realloc(row->chars, col + (nl - s) + 1);
+    memcpy(&row->chars[col], s, nl - s);
+    row->size = col + (nl - s);
+    row->chars[row->size] = '\0';
+  }
+  editorRowModified(row);
+  editorUpdateRow(row);
+  ECONFIG.dirty++;
+
+  if (endrow) *endrow = er;
+  if (endcol) *endcol = ec;
+}
+
+/* Find where len bytes of text starting at (at, col) end, clamped to the end of the buffer */
+void editorTextEnd(int at, int col, size_t len, int *endrow, int *endcol) {
+  while (at < ECONFIG.numrows) {
+    size_t avail = ECONFIG.row[at].size - col;
+    if (len <= avail || at == ECONFIG.numrows - 1) {
+      *endrow = at;
+      *endcol = col + (len < avail ? len : avail);
+      return;
+    }
+    len -= avail + 1;
+    at++;
+    col = 0;
+  }
+  *endrow = at;
+  *endcol = col;
+}
+
+/* Copy len bytes of text starting at (at, col), row breaks come out as '\n' */
+char *editorCopyText(int at, int col, size_t len) {
+  char *buf = malloc(len + 1);
+  size_t used = 0;
+  while (used < len && at < ECONFIG.numrows) {
+    editorRow *row = &ECONFIG.row[at];
+    size_t n = row->size - col;
+    if (n > len - used) n = len - used;
+    memcpy(&buf[used], &row->chars[col], n);
+    used += n;
+    if (used < len) buf[used++] = '\n';
+    at++;
+    col = 0;
+  }
+  buf[used] = '\0';
+  return buf;
+}
+
+void editorDeleteText(int at, int col, size_t len) {
+  if (at < 0 || at >= ECONFIG.numrows) return;
+  editorRow *row = &ECONFIG.row[at];
+  if (col < 0 || col > row->size) col = row->size;
+  editorBeginEdit();
+  journalRecordText(JOURNAL_DELETE_TEXT, at, col, NULL, len);
+  editorTouchRows(at);
+
+  int er, ec;
+  editorTextEnd(at, col, len, &er, &ec);
+  if (er == at) {
+    memmove(&row->chars[col], &row->chars[ec], row->size - ec + 1);
+    row->size -= ec - col;
+  }
+  else {
+    editorRow *last = &ECONFIG.row[er];
+    int taillen = last->size - ec;
+    row->chars = realloc(row->chars, col + taillen + 1);
+    memcpy(&row->chars[col], &last->chars[ec], taillen);
+    row->size = col + taillen;
+    row->chars[row->size] = '\0';
+
+    int j;
+    for (j = at + 1; j <= er; j++) editorFreeRow(&ECONFIG.row[j]);
+    memmove(&ECONFIG.row[at + 1], &ECONFIG.row[er + 1], sizeof(editorRow) * (ECONFIG.numrows - er - 1));
+    ECONFIG.numrows -= er - at;
+    if (ECONFIG.rowindex.built) rowIndexDelete(at + 1, er - at);
+  }
+  editorRowModified(row);
+  editorUpdateRow(row);
+  ECONFIG.dirty++;
+}
+
+void editorInsertChar(int c) {
+  if (ECONFIG.cy == ECONFIG.numrows) {
+    undoRecord(UNDO_NEWROW, ECONFIG.numrows, 0, NULL, 0);
+    editorInsertRow(ECONFIG.numrows, "", 0);
+  }
+  char ch = c;
+  undoRecord(UNDO_INSERT, ECONFIG.cy, ECONFIG.cx, &ch, 1);
+  editorRowInsertChar(&ECONFIG.row[ECONFIG.cy], ECONFIG.cx, c);
+  ECONFIG.cx++;
+}
+
+void editorInsertNewLine() {
+  if (ECONFIG.cy == ECONFIG.numrows) {
+    undoRecord(UNDO_NEWROW, ECONFIG.numrows, 0, NULL, 0);
+  }
+  else {
+    undoRecord(UNDO_INSERT, ECONFIG.cy, ECONFIG.cx, "\n", 1);
+  }
+
+  if (ECONFIG.cx == 0) {
+    editorInsertRow(ECONFIG.cy, "", 0);
+  }
+  else {
+    editorRow *row = &ECONFIG.row[ECONFIG.cy];
+    editorInsertRow(ECONFIG.cy + 1, &row->chars[ECONFIG.cx], row->size - ECONFIG.cx);
+    editorRowTruncate(&ECONFIG.row[ECONFIG.cy], ECONFIG.cx);
+  }
+  ECONFIG.cy++;
+  ECONFIG.cx = 0;
+}
+
+/* Read a bracketed paste up to its end marker, with line endings turned into '\n' */
+char *editorReadPaste(size_t *len) {
+  size_t cap = 4096, used = 0;
+  char *buf = malloc(cap);
+  int idle = 0;
+  *len = 0;
+
+  while (idle < 20) {
+    if (cap - used < 4096) {
+      cap *= 2;
+      buf = realloc(buf, cap);
+    }
+    ssize_t n = read(STDIN_FILENO, &buf[used], cap - used);
+    if (n == -1 && errno != EAGAIN) die("read");
+    if (n <= 0) {
+      idle++; /* the terminal never sent the end marker */
+      continue;
+    }
+    idle = 0;
+
+    size_t from = used > 5 ? used - 5 : 0;
+    used += n;
+    char *end = memmem(&buf[from], used - from, "\x1b[201~", 6);
+    if (end) {
+      used = end - buf;
+      break;
+    }
+  }
+
+  size_t i, j = 0;
+  for (i = 0; i < used; i++) {
+    if (buf[i] == '\r') {
+      if (i + 1 < used && buf[i + 1] == '\n') continue;
+      buf[j++] = '\n';
+    }
+    else {
+      buf[j++] = buf[i];
+    }
+  }
+  *len = j;
+  return buf;
+}
+
+/* Insert a whole paste as one edit and one undo group */
+void editorPaste() {
+  size_t len;
+  char *text = editorReadPaste(&len);
+  if (len > 0) {
+    undoBreak();
+    if (ECONFIG.cy == ECONFIG.numrows) {
+      undoRecord(UNDO_NEWROW, ECONFIG.numrows, 0, NULL, 0);
+      editorInsertRow(ECONFIG.numrows, "", 0);
+    }
+    undoRecord(UNDO_INSERT, ECONFIG.cy, ECONFIG.cx, text, len);
+    editorInsertText(ECONFIG.cy, ECONFIG.cx, text, len, &ECONFIG.cy, &ECONFIG.cx);
+    undoBreak();
+  }
+  free(text);
+}
+
+void editorDelChar() {
+  if (ECONFIG.cy == ECONFIG.numrows) return;
+  if (ECONFIG.cx == 0 && ECONFIG.cy == 0) return;
+
+  editorRow *row = &ECONFIG.row[ECONFIG.cy];
+  if (ECONFIG.cx > 0) {
+    int from = editorRowPrevChar(row, ECONFIG.cx);
+    undoRecord(UNDO_DELETE, ECONFIG.cy, from, &row->chars[from], ECONFIG.cx - from);
+    while (ECONFIG.cx > from) editorRowDelChar(row, --ECONFIG.cx);
+  }
+  else {
+    ECONFIG.cx = ECONFIG.row[ECONFIG.cy - 1].size;
+    undoRecord(UNDO_DELETE, ECONFIG.cy - 1, ECONFIG.cx, "\n", 1);
+    editorRowAppendString(&ECONFIG.row[ECONFIG.cy - 1], row->chars, row->size);
+    editorDelRow(ECONFIG.cy);
+    ECONFIG.cy--;
+  }
+}
+
+/*** unicode ***/
+
+/*
+ * Rows hold UTF-8. chars and render keep the bytes, so everything indexed by render
+ * byte (highlight classes, find spans, wrap segments) is unchanged and only the step
+ * from bytes to screen columns decodes. Rows without a byte >= 0x80, found with a SIMD
+ * scan in editorUpdateRow(), keep the one byte one column shortcut everywhere.
+ *
+ * Widths come from a two level table built on first use from the ranges below: wide
+ * East Asian characters and emoji take two columns, combining marks and other zero
+ * width characters none. Bytes that are not valid UTF-8 are rendered as '?'.
+ */
+
+struct widthRange {
+  uint32_t from, to;
+};
+
+const struct widthRange editorZeroWidth[] = {
+  {0x0300, 0x036F}, {0x0483, 0x0489}, {0x0591, 0x05BD}, {0x05BF, 0x05BF}, {0x05C1, 0x05C2},
+  {0x05C4, 0x05C5}, {0x05C7, 0x05C7}, {0x0610, 0x061A}, {0x064B, 0x065F}, {0x0670, 0x0670},
+  {0x06D6, 0x06DC}, {0x06DF, 0x06E4}, {0x06E7, 0x06E8}, {0x06EA, 0x06ED}, {0x0711, 0x0711},
+  {0x0730, 0x074A}, {0x07A6, 0x07B0}, {0x07EB, 0x07F3}, {0x0816, 0x0819}, {0x081B, 0x0823},
+  {0x0825, 0x0827}, {0x0829, 0x082D}, {0x0859, 0x085B}, {0x08D3, 0x08E1}, {0x08E3, 0x0902},
+  {0x093A, 0x093A}, {0x093C, 0x093C}, {0x0941, 0x0948}, {0x094D, 0x094D}, {0x0951, 0x0957},
+  {0x0962, 0x0963}, {0x0981, 0x0981}, {0x09BC, 0x09BC}, {0x09C1, 0x09C4}, {0x09CD, 0x09CD},
+  {0x09E2, 0x09E3}, {0x0A01, 0x0A02}, {0x0A3C, 0x0A3C}, {0x0A41, 0x0A51}, {0x0A70, 0x0A71},
+  {0x0A75, 0x0A75}, {0x0A81, 0x0A82}, {0x0ABC, 0x0ABC}, {0x0AC1, 0x0AC8}, {0x0ACD, 0x0ACD},
+  {0x0AE2, 0x0AE3}, {0x0B01, 0x0B01}, {0x0B3C, 0x0B3C}, {0x0B3F, 0x0B3F}, {0x0B41, 0x0B44},
+  {0x0B4D, 0x0B4D}, {0x0B56, 0x0B56}, {0x0B62, 0x0B63}, {0x0B82, 0x0B82}, {0x0BC0, 0x0BC0},
+  {0x0BCD, 0x0BCD}, {0x0C00, 0x0C00}, {0x0C3E, 0x0C40}, {0x0C46, 0x0C56}, {0x0C62, 0x0C63},
+  {0x0CBC, 0x0CBC}, {0x0CCC, 0x0CCD}, {0x0CE2, 0x0CE3}, {0x0D00, 0x0D01}, {0x0D41, 0x0D44},
+  {0x0D4D, 0x0D4D}, {0x0D62, 0x0D63}, {0x0DCA, 0x0DCA}, {0x0DD2, 0x0DD6}, {0x0E31, 0x0E31},
+  {0x0E34, 0x0E3A}, {0x0E47, 0x0E4E}, {0x0EB1, 0x0EB1}, {0x0EB4, 0x0EBC}, {0x0EC8, 0x0ECD},
+  {0x0F18, 0x0F19}, {0x0F35, 0x0F35}, {0x0F37, 0x0F37}, {0x0F39, 0x0F39}, {0x0F71, 0x0F7E},
+  {0x0F80, 0x0F84}, {0x0F86, 0x0F87}, {0x0F8D, 0x0FBC}, {0x0FC6, 0x0FC6}, {0x102D, 0x1030},
+  {0x1032, 0x1037}, {0x1039, 0x103A}, {0x103D, 0x103E}, {0x1058, 0x1059}, {0x105E, 0x1060},
+  {0x1071, 0x1074}, {0x1082, 0x1082}, {0x1085, 0x1086}, {0x108D, 0x108D}, {0x109D, 0x109D},
+  {0x1160, 0x11FF}, {0x135D, 0x135F}, {0x1712, 0x1714}, {0x1732, 0x1734}, {0x1752, 0x1753},
+  {0x1772, 0x1773}, {0x17B4, 0x17B5}, {0x17B7, 0x17BD}, {0x17C6, 0x17C6}, {0x17C9, 0x17D3},
+  {0x17DD, 0x17DD}, {0x180B, 0x180E}, {0x18A9, 0x18A9}, {0x1920, 0x1922}, {0x1927, 0x1928},
+  {0x1932, 0x1932}, {0x1939, 0x193B}, {0x1A17, 0x1A18}, {0x1A1B, 0x1A1B}, {0x1A56, 0x1A56},
+  {0x1A58, 0x1A60}, {0x1A62, 0x1A62}, {0x1A65, 0x1A6C}, {0x1A73, 0x1A7F}, {0x1AB0, 0x1AFF},
+  {0x1B00, 0x1B03}, {0x1B34, 0x1B34}, {0x1B36, 0x1B3A}, {0x1B3C, 0x1B3C}, {0x1B42, 0x1B42},
+  {0x1B6B, 0x1B73}, {0x1B80, 0x1B81}, {0x1BA2, 0x1BA5}, {0x1BA8, 0x1BA9}, {0x1BAB, 0x1BAD},
+  {0x1BE6, 0x1BE6}, {0x1BE8, 0x1BE9}, {0x1BED, 0x1BED}, {0x1BEF, 0x1BF1}, {0x1C2C, 0x1C33},
+  {0x1C36, 0x1C37}, {0x1CD0, 0x1CD2}, {0x1CD4, 0x1CE0}, {0x1CE2, 0x1CE8}, {0x1CED, 0x1CED},
+  {0x1CF4, 0x1CF4}, {0x1CF8, 0x1CF9}, {0x1DC0, 0x1DFF}, {0x200B, 0x200F}, {0x202A, 0x202E},
+  {0x2060, 0x2064}, {0x20D0, 0x20F0}, {0x2CEF, 0x2CF1}, {0x2D7F, 0x2D7F}, {0x2DE0, 0x2DFF},
+  {0x302A, 0x302D}, {0x3099, 0x309A}, {0xA66F, 0xA672}, {0xA674, 0xA67D}, {0xA69E, 0xA69F},
+  {0xA6F0, 0xA6F1}, {0xA802, 0xA802}, {0xA806, 0xA806}, {0xA80B, 0xA80B}, {0xA825, 0xA826},
+  {0xA8C4, 0xA8C5}, {0xA8E0, 0xA8F1}, {0xA926, 0xA92D}, {0xA947, 0xA951}, {0xA980, 0xA982},
+  {0xA9B3, 0xA9B3}, {0xA9B6, 0xA9B9}, {0xA9BC, 0xA9BD}, {0xA9E5, 0xA9E5}, {0xAA29, 0xAA2E},
+  {0xAA31, 0xAA32}, {0xAA35, 0xAA36}, {0xAA43, 0xAA43}, {0xAA4C, 0xAA4C}, {0xAAEC, 0xAAED},
+  {0xAAF6, 0xAAF6}, {0xABE5, 0xABE5}, {0xABE8, 0xABE8}, {0xABED, 0xABED}, {0xFB1E, 0xFB1E},
+  {0xFE00, 0xFE0F}, {0xFE20, 0xFE2F}, {0xFEFF, 0xFEFF}, {0x101FD, 0x101FD}, {0x10A01, 0x10A0F},
+  {0x10A38, 0x10A3F}, {0x11001, 0x11001}, {0x11038, 0x11046}, {0x1D167, 0x1D169}, {0x1D173, 0x1D182},
+  {0x1D185, 0x1D18B}, {0x1D1AA, 0x1D1AD}, {0xE0001, 0xE007F}, {0xE0100, 0xE01EF},
+};
+
+const struct widthRange editorDoubleWidth[] = {
+  {0x1100, 0x115F}, {0x231A, 0x231B}, {0x2329, 0x232A}, {0x23E9, 0x23EC}, {0x23F0, 0x23F0},
+  {0x23F3, 0x23F3}, {0x25FD, 0x25FE}, {0x2614, 0x2615}, {0x2648, 0x2653}, {0x267F, 0x267F},
+  {0x2693, 0x2693}, {0x26A1, 0x26A1}, {0x26AA, 0x26AB}, {0x26BD, 0x26BE}, {0x26C4, 0x26C5},
+  {0x26CE, 0x26CE}, {0x26D4, 0x26D4}, {0x26EA, 0x26EA}, {0x26F2, 0x26F3}, {0x26F5, 0x26F5},
+  {0x26FA, 0x26FA}, {0x26FD, 0x26FD}, {0x2705, 0x2705}, {0x270A, 0x270B}, {0x2728, 0x2728},
+  {0x274C, 0x274C}, {0x274E, 0x274E}, {0x2753, 0x2755}, {0x2757, 0x2757}, {0x2795, 0x2797},
+  {0x27B0, 0x27B0}, {0x27BF, 0x27BF}, {0x2B1B, 0x2B1C}, {0x2B50, 0x2B50}, {0x2B55, 0x2B55},
+  {0x2E80, 0x303E}, {0x3041, 0x33FF}, {0x3400, 0x4DBF}, {0x4E00, 0x9FFF}, {0xA000, 0xA4CF},
+  {0xA960, 0xA97F}, {0xAC00, 0xD7A3}, {0xF900, 0xFAFF}, {0xFE10, 0xFE19}, {0xFE30, 0xFE6F},
+  {0xFF00, 0xFF60}, {0xFFE0, 0xFFE6}, {0x16FE0, 0x16FE4}, {0x17000, 0x18AFF}, {0x1B000, 0x1B2FF},
+  {0x1F004, 0x1F004}, {0x1F0CF, 0x1F0CF}, {0x1F18E, 0x1F18E}, {0x1F191, 0x1F19A}, {0x1F200, 0x1F251},
+  {0x1F300, 0x1F64F}, {0x1F680, 0x1F6FF}, {0x1F7E0, 0x1F7EB}, {0x1F90C, 0x1F9FF}, {0x1FA70, 0x1FAFF},
+  {0x20000, 0x2FFFD}, {0x30000, 0x3FFFD},
+};
+
+#define EDITOR_WIDTH_LIMIT 0x40000 /* code points covered by the table */
+
+struct editorWidthTable {
+  uint16_t page[EDITOR_WIDTH_LIMIT >> 8]; /* block holding the widths of each 256 code points */
+  unsigned char (*blocks)[256]; /* distinct blocks, most pages share one */
+  int numblocks;
+};
+
+struct editorWidthTable EWIDTH;
+
+int editorInRanges(const struct widthRange *r, int n, uint32_t cp) {
+  int lo = 0, hi = n - 1;
+  while (lo <= hi) {
+    int mid = (lo + hi) / 2;
+    if (cp < r[mid].from) hi = mid - 1;
+    else if (cp > r[mid].to) lo = mid + 1;
+    else return 1;
+  }
+  return 0;
+}
+
+void editorBuildWidths() {
+  unsigned char block[256];
+  int p, k, b;
+  for (p = 0; p < EDITOR_WIDTH_LIMIT >> 8; p++) {
+    for (k = 0; k < 256; k++) {
+      uint32_t cp = (p << 8) | k;
+      if (editorInRanges(editorZeroWidth, sizeof(editorZeroWidth) / sizeof(editorZeroWidth[0]), cp)) block[k] = 0;
+      else if (editorInRanges(editorDoubleWidth, sizeof(editorDoubleWidth) / sizeof(editorDoubleWidth[0]), cp)) block[k] = 2;
+      else block[k] = 1;
+    }
+    for (b = 0; b < EWIDTH.numblocks && memcmp(EWIDTH.blocks[b], block, 256) != 0; b++);
+    if (b == EWIDTH.numblocks) {
+      EWIDTH.blocks = realloc(EWIDTH.blocks, 256 * (b + 1));
+      memcpy(EWIDTH.blocks[b], block, 256);
+      EWIDTH.numblocks++;
+    }
+    EWIDTH.page[p] = b;
+  }
+}
+
+/* Screen columns taken by code point cp */
+int editorCharWidth(uint32_t cp) {
+  static pthread_once_t once = PTHREAD_ONCE_INIT;
+  if (cp < 0x80) return 1;
+  if (cp >= EDITOR_WIDTH_LIMIT) return cp >= 0xE0001 && cp <= 0xE01EF ? 0 : 1;
+  pthread_once(&once, editorBuildWidths);
+  return EWIDTH.blocks[EWIDTH.page[cp >> 8]][cp & 0xff];
+}
+
+/* Decode the UTF-8 sequence at s, n bytes long at most; returns its length, or -1 if it is not valid */
+int editorDecodeUTF8(const unsigned char *s, int n, uint32_t *cp) {
+  uint32_t c = s[0];
+  int len, k;
+  if (c < 0x80) {
+    *cp = c;
+    return 1;
+  }
+  if (c >= 0xC2 && c <= 0xDF) {
+    len = 2;
+    c &= 0x1F;
+  }
+  else if (c >= 0xE0 && c <= 0xEF) {
+    len = 3;
+    c &= 0x0F;
+  }
+  else if (c >= 0xF0 && c <= 0xF4) {
+    len = 4;
+    c &= 0x07;
+  }
+  else {
+    return -1;
+  }
+  if (len > n) return -1;
+  for (k = 1; k < len; k++) {
+    if ((s[k] & 0xC0) != 0x80) return -1;
+    c = (c << 6) | (s[k] & 0x3F);
+  }
+  if ((len == 3 && c < 0x800) || (len == 4 && (c < 0x10000 || c > 0x10FFFF)) || (c >= 0xD800 && c <= 0xDFFF)) return -1;
+  *cp = c;
+  return len;
+}
+
+/* No byte of s[0..n) has the high bit set */
+int editorIsASCII(const char *s, int n) {
+  int i = 0;
+#ifdef EDITOR_HAVE_SSE2
+  __m128i acc = _mm_setzero_si128();
+  for (; i + 16 <= n; i += 16) acc = _mm_or_si128(acc, _mm_loadu_si128((const __m128i *) &s[i]));
+  if (_mm_movemask_epi8(acc)) return 0;
+#endif
+  for (; i + 8 <= n; i += 8) {
+    uint64_t w;
+    memcpy(&w, &s[i], 8);
+    if (w & 0x8080808080808080ull) return 0;
+  }
+  for (; i < n; i++) {
+    if (s[i] & 0x80) return 0;
+  }
+  return 1;
+}
+
+/* Replace the bytes of render that are not part of a valid UTF-8 sequence */
+void editorSanitizeRender(editorRow *row) {
+  int j = 0;
+  uint32_t cp;
+  while (j < row->rsize) {
+    int len = editorDecodeUTF8((const unsigned char *) &row->render[j], row->rsize - j, &cp);
+    if (len < 0) {
+      row->render[j] = '?';
+      len = 1;
+    }
+    j += len;
+  }
+}
+
+/* Width of the character at render[at], *len set to its length in bytes */
+int editorRenderChar(editorRow *row, int at, int *len) {
+  uint32_t cp;
+  *len = editorDecodeUTF8((const unsigned char *) &row->render[at], row->rsize - at, &cp);
+  if (*len < 0) {
+    *len = 1;
+    return 1;
+  }
+  return editorCharWidth(cp);
+}
+
+/*
+ * Checkpoints every EDITOR_COLMARK_STEP chars of a long row, each on a character
+ * boundary, so converting between chars offsets, render bytes and screen columns walks
+ * at most one step of the row from the nearest one instead of the row from its start.
+ * They are dropped by any change to the row and taken again only as far as lookups
+ * reach, so a frame near the start of a huge line never walks the rest of it.
+ */
+void editorTakeColMark(editorRow *row, struct colMarks *cm) {
+  int *prev = cm->mark[cm->count - 1];
+  int cx = prev[COLMARK_CX], rb = prev[COLMARK_RB], col = prev[COLMARK_COL], j = rb, len;
+  int target = cm->count * EDITOR_COLMARK_STEP;
+  while (cx < target || (cx < row->size && !row->ascii && (row->chars[cx] & 0xC0) == 0x80)) {
+    rb += editorRenderStep(row->chars[cx++], rb);
+  }
+  if (row->ascii) {
+    col = rb;
+  }
+  else {
+    while (j < rb) {
+      col += editorRenderChar(row, j, &len);
+      j += len;
+    }
+  }
+  cm->mark[cm->count][COLMARK_CX] = cx;
+  cm->mark[cm->count][COLMARK_RB] = rb;
+  cm->mark[cm->count][COLMARK_COL] = col;
+  cm->count++;
+}
+
+/* Last checkpoint of row whose field is <= value; rows shorter than a step only have the start */
+const int *editorColMark(editorRow *row, int field, int value) {
+  static const int start[3] = {0, 0, 0};
+  if (row->size < EDITOR_COLMARK_STEP) return start;
+  struct colMarks *cm = row->colmarks;
+  if (cm == NULL || cm->version != row->version) {
+    int total = row->size / EDITOR_COLMARK_STEP + 1;
+    cm = row->colmarks = realloc(cm, sizeof(*cm) + sizeof(cm->mark[0]) * total);
+    cm->total = total;
+    cm->version = row->version;
+    cm->count = 1;
+    cm->mark[0][COLMARK_CX] = cm->mark[0][COLMARK_RB] = cm->mark[0][COLMARK_COL] = 0;
+  }
+  while (cm->count < cm->total && cm->mark[cm->count - 1][field] <= value) editorTakeColMark(row, cm);
+  int lo = 0, hi = cm->count - 1;
+  while (lo < hi) {
+    int mid = (lo + hi + 1) / 2;
+    if (cm->mark[mid][field] <= value) lo = mid;
+    else hi = mid - 1;
+  }
+  return cm->mark[lo];
+}
+
+/* Screen column where render byte at starts */
+int editorRenderColumn(editorRow *row, int at) {
+  if (row->ascii) return at;
+  const int *m = editorColMark(row, COLMARK_RB, at);
+  int col = m[COLMARK_COL], j = m[COLMARK_RB], len;
+  while (j < at && j < row->rsize) {
+    col += editorRenderChar(row, j, &len);
+    j += len;
+  }
+  return col;
+}
+
+/* First render byte of a character starting at or after screen column col */
+int editorRenderAt(editorRow *row, int col) {
+  if (row->ascii) return col < row->rsize ? col : row->rsize;
+  const int *m = editorColMark(row, COLMARK_COL, col);
+  int c = m[COLMARK_COL], j = m[COLMARK_RB], len;
+  while (j < row->rsize) {
+    int w = editorRenderChar(row, j, &len);
+    if (c >= col && w > 0) break;
+    c += w;
+    j += len;
+  }
+  return j;
+}
+
+/* End of the longest run of render bytes from `from` that fits in cols screen columns */
+int editorRenderFit(editorRow *row, int from, int cols) {
+  int c = 0, j = from, len;
+  if (row->ascii) return row->rsize - from <= cols ? row->rsize : from + cols;
+  while (j < row->rsize) {
+    int w = editorRenderChar(row, j, &len);
+    if (c + w > cols) break;
+    c += w;
+    j += len;
+  }
+  return j;
+}
+
+/* Start of the character before chars[at]; combining marks go with the character they follow */
+int editorRowPrevChar(editorRow *row, int at) {
+  uint32_t cp;
+  if (row->ascii) return at - 1;
+  while (at > 0) {
+    at--;
+    while (at > 0 && (row->chars[at] & 0xC0) == 0x80) at--;
+    if (editorDecodeUTF8((const unsigned char *) &row->chars[at], row->size - at, &cp) < 0) break;
+    if (editorCharWidth(cp) != 0) break;
+  }
+  return at;
+}
+
+/* Start of the character after the one at chars[at] */
+int editorRowNextChar(editorRow *row, int at) {
+  uint32_t cp;
+  if (row->ascii) return at + 1;
+  int len = editorDecodeUTF8((const unsigned char *) &row->chars[at], row->size - at, &cp);
+  at += len > 0 ? len : 1;
+  while (at < row->size && (len = editorDecodeUTF8((const unsigned char *) &row->chars[at], row->size - at, &cp)) > 0 && editorCharWidth(cp) == 0) {
+    at += len;
+  }
+  return at;
+}
+
+/*** journal ***/
+
+/*
+ * Every edit since the last save is appended to .<name>.fjournal next to the file so it
+ * can be replayed after a crash. Records are buffered in memory and written out as
+ * checksummed frames once the user has been idle for EDITOR_JOURNAL_IDLE_MS, so typing
+ * never waits on the disk.
+ *
+ * header: "FLYJRNL" version dev ino size mtime_sec mtime_nsec (native byte order)
+ * frame:  u32 payload length, u32 FNV-1a of the payload, payload
+ * record: op byte followed by varint arguments, see journalApply()
+ */
+
+long long editorNowMs() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1000LL + ts.tv_nsec / 1000000;
+}
+
+uint32_t editorChecksum(const void *data, size_t len) {
+  const unsigned char *p = data;
+  uint32_t h = 2166136261u;
+  while (len--) {
+    h ^= *p++;
+    h *= 16777619u;
+  }
+  return h;
+}
+
+void fileIdentityFromStat(struct fileIdentity *id, struct stat *st) {
+  memset(id, 0, sizeof(*id));
+  id->dev = st->st_dev;
+  id->ino = st->st_ino;
+  id->size = st->st_size;
+  id->mtime_sec = st->st_mtim.tv_sec;
+  id->mtime_nsec = st->st_mtim.tv_nsec;
+}
+
+/* Hidden file next to filename, e.g. dir/.name.suffix */
+char *editorSidecarPath(const char *filename, const char *suffix) {
+  const char *base = strrchr(filename, '/');
+  int dirlen = base ? base - filename + 1 : 0;
+  base = base ? base + 1 : filename;
+  char *path = malloc(dirlen + strlen(base) + strlen(suffix) + 3);
+  sprintf(path, "%.*s.%s.%s", dirlen, filename, base, suffix);
+  return path;
+}
+
+/* Remember which file on disk the journal applies to, called after every open/save */
+void journalSetBase(const char *filename, struct stat *st) {
+  struct editorJournal *j = &ECONFIG.journal;
+  free(j->path);
+  j->path = NULL;
+  if (filename == NULL) return;
+
+  j->path = editorSidecarPath(filename, "fjournal");
+  memset(&j->base, 0, sizeof(j->base));
+  memcpy(j->base.magic, JOURNAL_MAGIC, sizeof(j->base.magic));
+  j->base.version = JOURNAL_VERSION;
+  fileIdentityFromStat(&j->base.file, st);
+}
+
+/* Stop journaling for this session after an error the journal can't be trusted past */
+void journalDisable() {
+  struct editorJournal *j = &ECONFIG.journal;
+  editorSetStatusMessage("Journal disabled: %s", strerror(errno));
+  if (j->fd != -1) close(j->fd);
+  j->fd = -1;
+  free(j->path);
+  j->path = NULL;
+  j->len = 0;
+}
+
+/*
+ * Write out buffered records as one frame, fsyncing if asked to. A frame that only got
+ * partly written is cut off again and its records kept for the next try, as replay
+ * stops at a torn frame and would drop every frame appended after it.
+ */
+void journalFlush(int sync) {
+  struct editorJournal *j = &ECONFIG.journal;
+  if (j->path == NULL) return;
+
+  if (j->len > 0) {
+    if (j->fd == -1) {
+      j->fd = open(j->path, O_WRONLY | O_CREAT | O_TRUNC | O_APPEND, 0600);
+      if (j->fd == -1 || write(j->fd, &j->base, sizeof(j->base)) != sizeof(j->base)) {
+        journalDisable();
+        return;
+      }
+    }
+
+    uint32_t frame[2] = {j->len, editorChecksum(j->buf, j->len)};
+    struct iovec iov[2] = {{frame, sizeof(frame)}, {j->buf, j->len}};
+    off_t before = lseek(j->fd, 0, SEEK_END);
+    if (writev(j->fd, iov, 2) != (ssize_t) (sizeof(frame) + j->len)) {
+      int saved = errno;
+      if (before == -1 || ftruncate(j->fd, before) == -1) {
+        journalDisable();
+        return;
+      }
+      editorSetStatusMessage("Journal write failed, will retry: %s", strerror(saved));
+      j->lastedit = editorNowMs(); /* not before the next idle period */
+      return;
+    }
+    j->len = 0;
+    j->unsynced = 1;
+  }
+
+  if (sync && j->unsynced && j->fd != -1) {
+    fdatasync(j->fd);
+    j->unsynced = 0;
+  }
+}
+
+/* Forget the journal, the file on disk now holds everything it had */
+void journalDiscard() {
+  struct editorJournal *j = &ECONFIG.journal;
+  if (j->fd != -1) {
+    close(j->fd);
+    j->fd = -1;
+  }
+  if (j->path) unlink(j->path);
+  j->len = 0;
+  j->unsynced = 0;
+}
+
+void journalPutVarint(uint64_t v) {
+  struct editorJournal *j = &ECONFIG.journal;
+  while (v >= 0x80) {
+    j->buf[j->len++] = (v & 0x7f) | 0x80;
+    v >>= 7;
+  }
+  j->buf[j->len++] = v;
+}
+
+/* Make room for a record of up to n bytes, returns -1 when nothing should be recorded */
+int journalReserve(size_t n) {
+  struct editorJournal *j = &ECONFIG.journal;
+  if (j->path == NULL || j->suspended) return -1;
+
+  if (j->len + n > j->cap) {
+    j->cap = (j->len + n) * 2;
+    j->buf = realloc(j->buf, j->cap);
+  }
+  return 0;
+}
+
+void journalRecorded() {
+  struct editorJournal *j = &ECONFIG.journal;
+  j->lastedit = editorNowMs();
+
+  /* don't let a long burst (e.g. a paste) pile up in memory, the fsync can still wait */
+  if (j->len >= EDITOR_JOURNAL_BATCH) journalFlush(0);
+}
+
+/* Append a record, s/len is the payload of the ops that carry bytes */
+void journalRecord(int op, int a, int b, const char *s, size_t len) {
+  struct editorJournal *j = &ECONFIG.journal;
+  if (journalReserve(len + 32) == -1) return;
+
+  j->buf[j->len++] = op;
+  journalPutVarint(a);
+  journalPutVarint(b);
+  if (s) {
+    memcpy(&j->buf[j->len], s, len);
+    j->len += len;
+  }
+  journalRecorded();
+}
+
+/* Append a text-level record, s is NULL for deletions */
+void journalRecordText(int op, int row, int col, const char *s, size_t len) {
+  struct editorJournal *j = &ECONFIG.journal;
+  if (journalReserve((s ? len : 0) + 48) == -1) return;
+
+  j->buf[j->len++] = op;
+  journalPutVarint(row);
+  journalPutVarint(col);
+  journalPutVarint(len);
+  if (s) {
+    memcpy(&j->buf[j->len], s, len);
+    j->len += len;
+  }
+  journalRecorded();
+}
+
+/* Called whenever the editor is waiting for input */
+void journalIdle() {
+  struct editorJournal *j = &ECONFIG.journal;
+  if ((j->len > 0 || j->unsynced) && editorNowMs() - j->lastedit >= EDITOR_JOURNAL_IDLE_MS) {
+    journalFlush(1);
+  }
+}
+
+int journalGetVarint(const unsigned char **p, const unsigned char *end, uint64_t *v) {
+  int shift = 0;
+  *v = 0;
+  while (*p < end && shift < 64) {
+    unsigned char c = *(*p)++;
+    *v |= (uint64_t) (c & 0x7f) << shift;
+    if (!(c & 0x80)) return 0;
+    shift += 7;
+  }
+  return -1;
+}
+
+/* Apply one record to the buffer, returns -1 if it doesn't make sense here */
+int journalApply(const unsigned char **p, const unsigned char *end) {
+  int op = *(*p)++;
+  uint64_t a, b;
+  if (journalGetVarint(p, end, &a) == -1 || journalGetVarint(p, end, &b) == -1) return -1;
+
+  switch (op) {
+    case JOURNAL_INSERT_ROW:
+      if (a > (uint64_t) ECONFIG.numrows || b > (uint64_t) (end - *p)) return -1;
+      editorInsertRow(a, (char *) *p, b);
+      *p += b;
+      return 0;
+    case JOURNAL_DEL_ROW:
+      if (a >= (uint64_t) ECONFIG.numrows) return -1;
+      editorDelRow(a);
+      return 0;
+    case JOURNAL_ROW_APPEND:
+      if (a >= (uint64_t) ECONFIG.numrows || b > (uint64_t) (end - *p)) return -1;
+      editorRowAppendString(&ECONFIG.row[a], (char *) *p, b);
+      *p += b;
+      return 0;
+  }
+
+  if (a >= (uint64_t) ECONFIG.numrows) return -1;
+  editorRow *row = &ECONFIG.row[a];
+  switch (op) {
+    case JOURNAL_ROW_INSERT_CHAR:
+      if (b > (uint64_t) row->size || *p >= end) return -1;
+      editorRowInsertChar(row, b, *(*p)++);
+      return 0;
+    case JOURNAL_ROW_DEL_CHAR:
+      if (b >= (uint64_t) row->size) return -1;
+      editorRowDelChar(row, b);
+      return 0;
+    case JOURNAL_ROW_TRUNCATE:
+      if (b > (uint64_t) row->size) return -1;
+      editorRowTruncate(row, b);
+      return 0;
+    case JOURNAL_INSERT_TEXT:
+    case JOURNAL_DELETE_TEXT:
+    {
+      uint64_t len;
+      if (b > (uint64_t) row->size || journalGetVarint(p, end, &len) == -1) return -1;
+      if (op == JOURNAL_DELETE_TEXT) {
+        editorDeleteText(a, b, len);
+        return 0;
+      }
+      if (len > (uint64_t) (end - *p)) return -1;
+      editorInsertText(a, b, (const char *) *p, len, NULL, NULL);
+      *p += len;
+      return 0;
+    }
+  }
+  return -1;
+}
+
+/*
+ * Replay the intact frames of the journal, returns the number of edits applied. It stops
+ * at the first record that doesn't apply, the buffer has diverged from what the journal
+ * was written against: *validlen is then the start of that record's frame and *rejected
+ * the offset of the record, otherwise *rejected is 0.
+ */
+int journalReplay(const unsigned char *data, size_t len, size_t *validlen, size_t *rejected) {
+  const unsigned char *p = data + sizeof(struct journalHeader);
+  const unsigned char *end = data + len;
+  int ops = 0;
+  *rejected = 0;
+
+  while (end - p >= 8) {
+    uint32_t frame[2];
+    memcpy(frame, p, sizeof(frame));
+    if (frame[0] > (size_t) (end - p - 8)) break; /* torn write at the end */
+    const unsigned char *rec = p + 8, *recend = rec + frame[0];
+    if (editorChecksum(rec, frame[0]) != frame[1]) break;
+
+    while (rec < recend) {
+      const unsigned char *at = rec;
+      if (journalApply(&rec, recend) == -1) {
+        *validlen = p - data;
+        *rejected = at - data;
+        return ops;
+      }
+      ops++;
+    }
+    p = recend;
+  }
+  *validlen = p - data;
+  return ops;
+}
+
+/* Offer to recover the edits left behind by a previous session on this file */
+void journalRecover() {
+  struct editorJournal *j = &ECONFIG.journal;
+  if (j->path == NULL) return;
+
+  int fd = open(j->path, O_RDONLY);
+  if (fd == -1) return;
+  struct stat st;
+  unsigned char *data = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && (size_t) st.st_size > sizeof(struct journalHeader)) {
+    data = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (data == MAP_FAILED) return;
+
+  if (memcmp(data, &j->base, sizeof(j->base)) != 0) {
+    editorSetStatusMessage("Ignoring journal %s, the file changed since it was written", j->path);
+  }
+  else if (editorConfirm("Unsaved changes from a previous session were found. Recover them? (y/n)")) {
+    size_t validlen, rejected;
+    j->suspended = 1;
+    int ops = journalReplay(data, st.st_size, &validlen, &rejected);
+    j->suspended = 0;
+    ECONFIG.dirty += ops;
+    ECONFIG.undo.history_checked = 1; /* saved undo history no longer lines up with the buffer */
+    if (rejected) editorSetStatusMessage("Recovered %d edits from %s, the rest did not apply", ops, j->path);
+    else editorSetStatusMessage("Recovered %d edits from %s", ops, j->path);
+
+    /* the records of a cut frame that were applied go out again as a frame of their own */
+    size_t keep = rejected ? rejected - validlen - 8 : 0;
+    if (keep > 0 && journalReserve(keep) == 0) {
+      memcpy(&j->buf[j->len], data + validlen + 8, keep); /* before the truncate takes them from the map */
+      j->len += keep;
+    }
+    munmap(data, st.st_size);
+
+    /* keep appending to the same journal, past the last intact frame */
+    j->fd = open(j->path, O_WRONLY | O_APPEND);
+    if (j->fd != -1 && (size_t) st.st_size != validlen) ftruncate(j->fd, validlen);
+    if (j->len > 0) journalRecorded();
+    return;
+  }
+  munmap(data, st.st_size);
+}
+
+/* Best effort: get buffered edits to disk when the terminal goes away */
+void journalSignalHandler(int sig) {
+  journalFlush(0);
+  signal(sig, SIG_DFL);
+  raise(sig);
+}
+
+void editorIdle() {
+  journalIdle();
+  if (searchPoll() | hlPoll() | viewPoll() | editorCheckDisk()) refreshScreen();
+}
+
+/*** undo ***/
+
+/*
+ * Edits made by the user are logged as text-level records in one growable arena:
+ * [head, cur) can be undone and [cur, tail) redone. Records of one group are undone
+ * together, and typing keeps extending the newest record instead of adding one per
+ * key. Each record ends with its size so the log can be walked backwards. When the
+ * log outgrows ECONFIG.undo.limit the oldest groups are dropped.
+ */
+
+size_t undoRecordSize(size_t len) {
+  return (sizeof(struct undoRecord) + len + 3) / 4 * 4 + sizeof(uint32_t);
+}
+
+struct undoRecord *undoAt(size_t off) {
+  return (struct undoRecord *) (ECONFIG.undo.buf + off);
+}
+
+char *undoText(struct undoRecord *r) {
+  return (char *) (r + 1);
+}
+
+size_t undoPrev(size_t off) {
+  uint32_t size;
+  memcpy(&size, ECONFIG.undo.buf + off - sizeof(size), sizeof(size));
+  return off - size;
+}
+
+void undoSetSize(size_t off, uint32_t size) {
+  undoAt(off)->size = size;
+  memcpy(ECONFIG.undo.buf + off + size - sizeof(size), &size, sizeof(size));
+}
+
+/* Make room for n more bytes at the tail, sliding the log back to the start when that's enough */
+void undoReserve(size_t n) {
+  struct editorUndo *u = &ECONFIG.undo;
+  if (u->tail + n <= u->cap) return;
+
+  if (u->head > 0 && u->tail - u->head + n <= u->cap) {
+    memmove(u->buf, u->buf + u->head, u->tail - u->head);
+    u->cur -= u->head;
+    u->tail -= u->head;
+    u->head = 0;
+    return;
+  }
+  u->cap = (u->tail + n) * 2;
+  u->buf = realloc(u->buf, u->cap);
+}
+
+/* Drop whole groups from the old end until the log fits its budget again */
+void undoTrim() {
+  struct editorUndo *u = &ECONFIG.undo;
+  while (u->tail - u->head > u->limit && u->head < u->cur) {
+    uint32_t group = undoAt(u->head)->group;
+    if (group == u->group) break; /* never drop the group being built */
+    u->history_checked = 1; /* older saved history can no longer be attached */
+    while (u->head < u->cur && undoAt(u->head)->group == group) {
+      u->head += undoAt(u->head)->size;
+    }
+  }
+  if (u->head == u->tail) u->head = u->cur = u->tail = 0;
+}
+
+/* Stop the next edit from joining the current group */
+void undoBreak() {
+  ECONFIG.undo.open = 0;
+}
+
+/* Where text inserted at (row, col) ends */
+void undoTextEnd(int row, int col, const char *s, size_t len, int *endrow, int *endcol) {
+  const char *end = s + len, *p;
+  *endrow = row;
+  *endcol = col + len;
+  if (len == 0) return;
+  for (p = s; (p = memchr(p, '\n', end - p)) != NULL; p++) {
+    (*endrow)++;
+    *endcol = end - p - 1;
+  }
+}
+
+void undoRecord(int type, int row, int col, const char *s, size_t len) {
+  struct editorUndo *u = &ECONFIG.undo;
+  u->tail = u->cur; /* a new edit forgets what could be redone */
+
+  if (u->open && u->cur > u->head && !u->bulk) {
+    size_t off = undoPrev(u->cur);
+    struct undoRecord *r = undoAt(off);
+    int endrow, endcol;
+    undoTextEnd(row, col, s, len, &endrow, &endcol);
+
+    int append = (type == UNDO_INSERT && r->type == UNDO_INSERT && row == u->endrow && col == u->endcol) ||
+      (type == UNDO_DELETE && r->type == UNDO_DELETE && row == r->row && col == r->col);
+    int prepend = (type == UNDO_DELETE && r->type == UNDO_DELETE && endrow == r->row && endcol == r->col);
+
+    if (append || prepend) {
+      size_t oldsize = r->size;
+      size_t size = undoRecordSize(r->len + len);
+      undoReserve(size - oldsize);
+      off = u->cur - oldsize;
+      r = undoAt(off);
+      if (append) {
+        memcpy(undoText(r) + r->len, s, len);
+        undoTextEnd(u->endrow, u->endcol, s, len, &u->endrow, &u->endcol);
+      }
+      else {
+        memmove(undoText(r) + len, undoText(r), r->len);
+        memcpy(undoText(r), s, len);
+        r->row = row;
+        r->col = col;
+      }
+      r->len += len;
+      undoSetSize(off, size);
+      u->cur = u->tail = off + size;
+      undoTrim();
+      return;
+    }
+    if ((int) r->type != type && r->type != UNDO_NEWROW) u->open = 0;
+  }
+
+  if (!u->open) {
+    u->group++;
+    u->open = 1;
+  }
+  size_t size = undoRecordSize(len);
+  undoReserve(size);
+  struct undoRecord *r = undoAt(u->tail);
+  r->group = u->group;
+  r->type = type;
+  r->row = row;
+  r->col = col;
+  r->len = len;
+  if (len) memcpy(undoText(r), s, len);
+  undoSetSize(u->tail, size);
+  u->cur = u->tail += size;
+  undoTextEnd(row, col, s, len, &u->endrow, &u->endcol);
+  undoTrim();
+}
+
+void editorClampCursor() {
+  if (ECONFIG.cy > ECONFIG.numrows) ECONFIG.cy = ECONFIG.numrows;
+  if (ECONFIG.cy < 0) ECONFIG.cy = 0;
+  int rowlen = ECONFIG.cy < ECONFIG.numrows ? ECONFIG.row[ECONFIG.cy].size : 0;
+  if (ECONFIG.cx > rowlen) ECONFIG.cx = rowlen;
+}
+
+/* Revert the newest group, each record is a single bulk edit however big it is */
+void editorUndo() {
+  struct editorUndo *u = &ECONFIG.undo;
+  if (u->cur == u->head) undoLoadHistory();
+  if (u->cur == u->head) {
+    editorSetStatusMessage("Nothing to undo");
+    return;
+  }
+  undoBreak();
+
+  uint32_t group = undoAt(undoPrev(u->cur))->group;
+  while (u->cur > u->head) {
+    size_t off = undoPrev(u->cur);
+    struct undoRecord *r = undoAt(off);
+    if (r->group != group) break;
+
+    switch (r->type) {
+      case UNDO_INSERT:
+        editorDeleteText(r->row, r->col, r->len);
+        break;
+      case UNDO_DELETE:
+        editorInsertText(r->row, r->col, undoText(r), r->len, NULL, NULL);
+        break;
+      case UNDO_NEWROW:
+        editorDelRow(r->row);
+        break;
+    }
+    ECONFIG.cy = r->row;
+    ECONFIG.cx = r->col;
+    u->cur = off;
+  }
+  editorClampCursor();
+}
+
+void editorRedo() {
+  struct editorUndo *u = &ECONFIG.undo;
+  if (u->cur == u->tail) {
+    editorSetStatusMessage("Nothing to redo");
+    return;
+  }
+  undoBreak();
+
+  uint32_t group = undoAt(u->cur)->group;
+  while (u->cur < u->tail) {
+    struct undoRecord *r = undoAt(u->cur);
+    if (r->group != group) break;
+
+    ECONFIG.cy = r->row;
+    ECONFIG.cx = r->col;
+    switch (r->type) {
+      case UNDO_INSERT:
+        editorInsertText(r->row, r->col, undoText(r), r->len, &ECONFIG.cy, &ECONFIG.cx);
+        break;
+      case UNDO_DELETE:
+        editorDeleteText(r->row, r->col, r->len);
+        break;
+      case UNDO_NEWROW:
+        editorInsertRow(r->row, "", 0);
+        break;
+    }
+    u->cur += r->size;
+  }
+  editorClampCursor();
+}
+
+/*
+ * Undo history is kept across sessions in .<name>.fundo, written on save and tied to the
+ * identity of the file that was saved. It is only read back on the first undo that runs
+ * past what this session recorded (or on the next save), and only if the buffer still
+ * descends from that exact file.
+ */
+
+/* Prepend the history saved with the file this buffer was loaded from */
+void undoLoadHistory() {
+  struct editorUndo *u = &ECONFIG.undo;
+  if (u->history_checked || ECONFIG.filename == NULL) return;
+  u->history_checked = 1;
+
+  char *path = editorSidecarPath(ECONFIG.filename, "fundo");
+  int fd = open(path, O_RDONLY);
+  free(path);
+  if (fd == -1) return;
+
+  struct undoFileHeader hdr;
+  char *data = NULL;
+  if (read(fd, &hdr, sizeof(hdr)) != sizeof(hdr)) goto out;
+  if (memcmp(hdr.magic, UNDO_FILE_MAGIC, sizeof(hdr.magic)) != 0 || hdr.version != UNDO_FILE_VERSION) goto out;
+  if (memcmp(&hdr.file, &u->origin, sizeof(hdr.file)) != 0 || hdr.len > EDITOR_UNDO_FILE_LIMIT) goto out;
+
+  data = malloc(hdr.len + (u->tail - u->head) + 1);
+  if (read(fd, data, hdr.len) != (ssize_t) hdr.len) goto out;
+  if (editorChecksum(data, hdr.len) != hdr.checksum) goto out;
+
+  /* check the records chain up, and give their groups ids this session can't reach */
+  size_t off = 0;
+  uint32_t group = 0, last = 0;
+  while (off < hdr.len) {
+    struct undoRecord *r = (struct undoRecord *) (data + off);
+    uint32_t trailer;
+    if (hdr.len - off < undoRecordSize(0) || r->size < undoRecordSize(0) || r->size > hdr.len - off) goto out;
+    if (r->size != undoRecordSize(r->len)) goto out;
+    memcpy(&trailer, data + off + r->size - sizeof(trailer), sizeof(trailer));
+    if (trailer != r->size) goto out;
+    if (off == 0 || r->group != last) group++;
+    last = r->group;
+    r->group = 0x80000000u | group;
+    off += r->size;
+  }
+
+  memcpy(data + hdr.len, u->buf + u->head, u->tail - u->head);
+  u->cur = hdr.len + (u->cur - u->head);
+  u->tail = hdr.len + (u->tail - u->head);
+  u->head = 0;
+  u->cap = u->tail + 1;
+  free(u->buf);
+  u->buf = data;
+  data = NULL;
+  undoTrim();
+
+out:
+  free(data);
+  close(fd);
+}
+
+/* Save the undoable part of the log next to the file that was just written */
+void undoSaveHistory(struct stat *st) {
+  struct editorUndo *u = &ECONFIG.undo;
+  undoLoadHistory();
+  fileIdentityFromStat(&u->origin, st);
+
+  char *path = editorSidecarPath(ECONFIG.filename, "fundo");
+  if (u->cur == u->head) {
+    unlink(path);
+    free(path);
+    return;
+  }
+
+  /* compact oldest first, cutting only between groups */
+  size_t from = u->head;
+  while (u->cur - from > EDITOR_UNDO_FILE_LIMIT) {
+    uint32_t group = undoAt(from)->group;
+    while (from < u->cur && undoAt(from)->group == group) from += undoAt(from)->size;
+  }
+
+  struct undoFileHeader hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.magic, UNDO_FILE_MAGIC, sizeof(hdr.magic));
+  hdr.version = UNDO_FILE_VERSION;
+  hdr.file = u->origin;
+  hdr.len = u->cur - from;
+  hdr.checksum = editorChecksum(u->buf + from, hdr.len);
+
+  char *tmp = malloc(strlen(path) + 5);
+  sprintf(tmp, "%s.tmp", path);
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd != -1) {
+    struct iovec iov[2] = {{&hdr, sizeof(hdr)}, {u->buf + from, hdr.len}};
+    if (writev(fd, iov, 2) == (ssize_t) (sizeof(hdr) + hdr.len) && close(fd) == 0) {
+      rename(tmp, path);
+    }
+    else {
+      close(fd);
+      unlink(tmp);
+    }
+  }
+  free(tmp);
+  free(path);
+}
+
+/*** file i/o ***/
+
+/*
+ * Reads on open and writes on save go through a small queue of EDITOR_IO_DEPTH
+ * slots. With io_uring several chunks are in flight at once; without it every
+ * submission is performed on the spot with pread/pwrite.
+ */
+
+enum editorIOOp {
+  IO_READ,
+  IO_WRITE,
+  IO_WRITEV
+};
+
+struct editorIOSlot {
+  int busy;
+  int op;
+  ssize_t res;
+  void *buf;
+  size_t len; /* as submitted: bytes, or iovecs for IO_WRITEV */
+  size_t want; /* bytes the operation should transfer, 0 once it has been reaped */
+  off_t off;
+  void *owned; /* freed once the slot completes, see ioFree() */
+  struct iovec iov[2];
+};
+
+struct editorIO {
+  int fd;
+  int ring_fd; /* -1 when falling back to pread/pwrite */
+  int pending; /* queued submissions not yet handed to the kernel */
+  struct editorIOSlot slot[EDITOR_IO_DEPTH];
+#ifdef EDITOR_HAVE_URING
+  void *sq_ptr, *cq_ptr;
+  size_t sq_size, cq_size;
+  struct io_uring_sqe *sqes;
+  size_t sqes_size;
+  unsigned *sq_head, *sq_tail, *sq_mask, *sq_array;
+  unsigned *cq_head, *cq_tail, *cq_mask;
+  struct io_uring_cqe *cqes;
+#endif
+};
+
+#ifdef EDITOR_HAVE_URING
+/* Whether the kernel takes every opcode ioSubmit() uses, a ring set up by 5.1 to 5.5 doesn't */
+int ioUringProbe(int ring_fd) {
+  int ops[] = {IORING_OP_READ, IORING_OP_WRITE, IORING_OP_WRITEV}, j;
+  size_t size = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+  struct io_uring_probe *probe = calloc(1, size);
+  int ok = syscall(__NR_io_uring_register, ring_fd, IORING_REGISTER_PROBE, probe, 256) == 0;
+  for (j = 0; ok && j < (int) (sizeof(ops) / sizeof(ops[0])); j++) {
+    ok = ops[j] <= probe->last_op && (probe->ops[ops[j]].flags & IO_URING_OP_SUPPORTED);
+  }
+  free(probe);
+  return ok;
+}
+
+int ioUringInit(struct editorIO *io) {
+  struct io_uring_params p;
+  memset(&p, 0, sizeof(p));
+  io->ring_fd = syscall(__NR_io_uring_setup, EDITOR_IO_DEPTH, &p);
+  if (io->ring_fd < 0) return -1;
+  if (!(p.features & IORING_FEAT_RW_CUR_POS) || !ioUringProbe(io->ring_fd)) goto fail;
+
+  io->sq_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+  io->cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    if (io->cq_size > io->sq_size) io->sq_size = io->cq_size;
+    io->cq_size = io->sq_size;
+  }
+  io->sq_ptr = mmap(NULL, io->sq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+    io->ring_fd, IORING_OFF_SQ_RING);
+  if (io->sq_ptr == MAP_FAILED) goto fail;
+  if (p.features & IORING_FEAT_SINGLE_MMAP) {
+    io->cq_ptr = io->sq_ptr;
+  }
+  else {
+    io->cq_ptr = mmap(NULL, io->cq_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+      io->ring_fd, IORING_OFF_CQ_RING);
+    if (io->cq_ptr == MAP_FAILED) {
+      munmap(io->sq_ptr, io->sq_size);
+      goto fail;
+    }
+  }
+  io->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+  io->sqes = mmap(NULL, io->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+    io->ring_fd, IORING_OFF_SQES);
+  if (io->sqes == MAP_FAILED) {
+    munmap(io->sq_ptr, io->sq_size);
+    if (io->cq_ptr != io->sq_ptr) munmap(io->cq_ptr, io->cq_size);
+    goto fail;
+  }
+
+  char *sq = io->sq_ptr, *cq = io->cq_ptr;
+  io->sq_head = (unsigned *) (sq + p.sq_off.head);
+  io->sq_tail = (unsigned *) (sq + p.sq_off.tail);
+  io->sq_mask = (unsigned *) (sq + p.sq_off.ring_mask);
+  io->sq_array = (unsigned *) (sq + p.sq_off.array);
+  io->cq_head = (unsigned *) (cq + p.cq_off.head);
+  io->cq_tail = (unsigned *) (cq + p.cq_off.tail);
+  io->cq_mask = (unsigned *) (cq + p.cq_off.ring_mask);
+  io->cqes = (struct io_uring_cqe *) (cq + p.cq_off.cqes);
+  return 0;
+
+fail:
+  close(io->ring_fd);
+  io->ring_fd = -1;
+  return -1;
+}
+
+/* Hand queued submissions to the kernel, optionally waiting for one completion */
+int ioUringEnter(struct editorIO *io, int wait) {
+  while (1) {
+    int n = syscall(__NR_io_uring_enter, io->ring_fd, io->pending, wait ? 1 : 0,
+      wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    if (n >= 0) {
+      io->pending -= n;
+      return 0;
+    }
+    if (errno != EINTR) return -1;
+  }
+}
+
+/* Record every completion that is already available in its slot */
+void ioUringReap(struct editorIO *io) {
+  unsigned head = *io->cq_head;
+  while (head != __atomic_load_n(io->cq_tail, __ATOMIC_ACQUIRE)) {
+    struct io_uring_cqe *cqe = &io->cqes[head & *io->cq_mask];
+    struct editorIOSlot *slot = &io->slot[cqe->user_data];
+    slot->res = cqe->res;
+    slot->busy = 0;
+    head++;
+  }
+  __atomic_store_n(io->cq_head, head, __ATOMIC_RELEASE);
+}
+#endif
+
+void ioInit(struct editorIO *io, int fd) {
+  memset(io, 0, sizeof(*io));
+  io->fd = fd;
+  io->ring_fd = -1;
+#ifdef EDITOR_HAVE_URING
+  ioUringInit(io);
+#endif
+}
+
+/*
+ * Wait for everything in flight and release the ring. Buffers handed over with a slot
+ * are freed once it completed; if the ring fails first they are leaked, as the kernel
+ * may still be reading them.
+ */
+void ioFree(struct editorIO *io) {
+  int j;
+#ifdef EDITOR_HAVE_URING
+  if (io->ring_fd != -1) {
+    for (j = 0; j < EDITOR_IO_DEPTH; j++) {
+      while (io->slot[j].busy) {
+        if (ioUringEnter(io, 1) == -1) break;
+        ioUringReap(io);
+      }
+    }
+    munmap(io->sqes, io->sqes_size);
+    if (io->cq_ptr != io->sq_ptr) munmap(io->cq_ptr, io->cq_size);
+    munmap(io->sq_ptr, io->sq_size);
+    close(io->ring_fd);
+    io->ring_fd = -1;
+  }
+#endif
+  for (j = 0; j < EDITOR_IO_DEPTH; j++) {
+    if (!io->slot[j].busy) free(io->slot[j].owned);
+    io->slot[j].owned = NULL;
+  }
+}
+
+/* Perform a slot's operation on the spot with pread/pwrite */
+void ioPerform(struct editorIO *io, struct editorIOSlot *s) {
+  do {
+    if (s->op == IO_READ) s->res = pread(io->fd, s->buf, s->len, s->off);
+    else if (s->op == IO_WRITE) s->res = pwrite(io->fd, s->buf, s->len, s->off);
+    else s->res = pwritev(io->fd, s->iov, s->len, s->off);
+  } while (s->res == -1 && errno == EINTR);
+  if (s->res == -1) s->res = -errno;
+  s->busy = 0;
+}
+
+/* Queue an operation on a free slot, buf is an iovec array for IO_WRITEV */
+void ioSubmit(struct editorIO *io, int slot, int op, void *buf, size_t len, off_t off) {
+  struct editorIOSlot *s = &io->slot[slot];
+  s->op = op;
+  s->buf = buf;
+  s->len = len;
+  s->want = len;
+  s->off = off;
+  if (op == IO_WRITEV) {
+    size_t j;
+    memcpy(s->iov, buf, len * sizeof(struct iovec));
+    for (s->want = 0, j = 0; j < len; j++) s->want += s->iov[j].iov_len;
+  }
+  s->busy = 1;
+
+#ifdef EDITOR_HAVE_URING
+  if (io->ring_fd != -1) {
+    unsigned tail = *io->sq_tail;
+    unsigned idx = tail & *io->sq_mask;
+    struct io_uring_sqe *sqe = &io->sqes[idx];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = op == IO_READ ? IORING_OP_READ : op == IO_WRITE ? IORING_OP_WRITE : IORING_OP_WRITEV;
+    sqe->fd = io->fd;
+    sqe->addr = (unsigned long) (op == IO_WRITEV ? (void *) s->iov : buf);
+    sqe->len = len;
+    sqe->off = off;
+    sqe->user_data = slot;
+    io->sq_array[idx] = idx;
+    __atomic_store_n(io->sq_tail, tail + 1, __ATOMIC_RELEASE);
+    io->pending++;
+    return;
+  }
+#endif
+  ioPerform(io, s);
+}
+
+/* Start whatever has been queued without waiting for it */
+void ioFlush(struct editorIO *io) {
+#ifdef EDITOR_HAVE_URING
+  if (io->ring_fd != -1 && io->pending > 0) ioUringEnter(io, 0);
+#else
+  (void) io;
+#endif
+}
+
+/*
+ * Wait for a slot to complete and return its result, negative errno on failure. If the
+ * ring fails the slot stays busy, and its buffer must be kept until ioFree().
+ */
+ssize_t ioWait(struct editorIO *io, int slot) {
+  struct editorIOSlot *s = &io->slot[slot];
+#ifdef EDITOR_HAVE_URING
+  if (io->ring_fd != -1) {
+    ioUringReap(io);
+    while (s->busy) {
+      if (ioUringEnter(io, 1) == -1) return -errno;
+      ioUringReap(io);
+    }
+    /* an opcode the kernel turned down after all, do it the old way */
+    if (s->res == -EINVAL || s->res == -EOPNOTSUPP) ioPerform(io, s);
+  }
+#endif
+  return s->res;
+}
+
+/* pwrite() that retries on short writes */
+int editorWriteAt(int fd, const char *buf, size_t len, off_t off) {
+  while (len > 0) {
+    ssize_t n = pwrite(fd, buf, len, off);
+    if (n == -1) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    buf += n;
+    len -= n;
+    off += n;
+  }
+  return 0;
+}
+
+/* Reap a write slot, redoing it synchronously if it came back short. Unused slots are a no-op */
+int ioWaitWrite(struct editorIO *io, int slot) {
+  struct editorIOSlot *s = &io->slot[slot];
+  if (s->want == 0) return 0;
+
+  ssize_t n = ioWait(io, slot);
+  if (s->busy) {
+    errno = -n;
+    return -1;
+  }
+  size_t want = s->want;
+  s->want = 0;
+  if (n < 0) {
+    errno = -n;
+    return -1;
+  }
+  if ((size_t) n == want) return 0;
+
+  if (s->op == IO_WRITE) return editorWriteAt(io->fd, s->buf, want, s->off);
+  if (editorWriteAt(io->fd, s->iov[0].iov_base, s->iov[0].iov_len, s->off) == -1) return -1;
+  return editorWriteAt(io->fd, s->iov[1].iov_base, s->iov[1].iov_len, s->off + s->iov[0].iov_len);
+}
+
+/* Add one line read from disk, rawlen includes its line terminator */
+void editorOpenLine(char *line, ssize_t rawlen, off_t off, int *firstbad) {
+  ssize_t linelen = rawlen;
+  while (linelen > 0 && (line[linelen - 1] == '\n' || line[linelen -1] == '\r')) {
+    linelen--;
+  }
+
+  editorInsertRow(ECONFIG.numrows, line, linelen);
+
+  /* rows that weren't stored as chars + '\n' (CRLF, missing final newline) need rewriting on save */
+  editorRow *row = &ECONFIG.row[ECONFIG.numrows - 1];
+  row->disk_off = off;
+  row->disk_len = linelen;
+  row->modified = (rawlen != linelen + 1 || line[linelen] != '\n');
+  if (row->modified && *firstbad == -1) *firstbad = ECONFIG.numrows - 1;
+}
+
+void editorOpen(char *filename) {
+  free(ECONFIG.filename);
+  ECONFIG.filename = strdup(filename);
+
+  int fd = open(filename, O_RDONLY);
+  if (fd == -1) die("open");
+  struct stat st;
+  if (fstat(fd, &st) == -1) die("fstat");
+
+  struct editorIO io;
+  ioInit(&io, fd);
+
+  /* keep a read in flight on every slot, then split chunks into lines in file order */
+  char *chunk[EDITOR_IO_DEPTH];
+  off_t next = 0;
+  int j;
+  for (j = 0; j < EDITOR_IO_DEPTH; j++) {
+    chunk[j] = malloc(EDITOR_IO_CHUNK);
+    if (next < st.st_size) {
+      size_t len = st.st_size - next < EDITOR_IO_CHUNK ? st.st_size - next : EDITOR_IO_CHUNK;
+      ioSubmit(&io, j, IO_READ, chunk[j], len, next);
+      next += len;
+    }
+  }
+  ioFlush(&io);
+
+  char *carry = NULL;
+  size_t carrylen = 0, carrycap = 0;
+  off_t pos = 0, lineoff = 0;
+  int firstbad = -1;
+  int k;
+  for (k = 0; pos < st.st_size; k = (k + 1) % EDITOR_IO_DEPTH) {
+    size_t want = st.st_size - pos < EDITOR_IO_CHUNK ? st.st_size - pos : EDITOR_IO_CHUNK;
+    ssize_t n = ioWait(&io, k);
+    if (n < 0) {
+      errno = -n;
+      die("read");
+    }
+    while ((size_t) n < want) { /* short read, finish it here */
+      ssize_t m = pread(fd, chunk[k] + n, want - n, pos + n);
+      if (m == -1 && errno == EINTR) continue;
+      if (m <= 0) die("read");
+      n += m;
+    }
+
+    char *p = chunk[k], *end = chunk[k] + want;
+    char *nl;
+    while ((nl = memchr(p, '\n', end - p)) != NULL) {
+      size_t len = nl - p + 1;
+      if (carrylen > 0) {
+        if (carrylen + len > carrycap) {
+          carrycap = (carrylen + len) * 2;
+          carry = realloc(carry, carrycap);
+        }
+        memcpy(carry + carrylen, p, len);
+        editorOpenLine(carry, carrylen + len, lineoff, &firstbad);
+        lineoff += carrylen + len;
+        carrylen = 0;
+      }
+      else {
+        editorOpenLine(p, len, lineoff, &firstbad);
+        lineoff += len;
+      }
+      p = nl + 1;
+    }
+    if (p < end) {
+      if (carrylen + (end - p) > carrycap) {
+        carrycap = (carrylen + (end - p)) * 2;
+        carry = realloc(carry, carrycap);
+      }
+      memcpy(carry + carrylen, p, end - p);
+      carrylen += end - p;
+    }
+    pos += want;
+
+    if (next < st.st_size) {
+      size_t len = st.st_size - next < EDITOR_IO_CHUNK ? st.st_size - next : EDITOR_IO_CHUNK;
+      ioSubmit(&io, k, IO_READ, chunk[k], len, next);
+      ioFlush(&io);
+      next += len;
+    }
+  }
+  if (carrylen > 0) editorOpenLine(carry, carrylen, lineoff, &firstbad);
+
+  ioFree(&io);
+  for (j = 0; j < EDITOR_IO_DEPTH; j++) free(chunk[j]);
+  free(carry);
+  close(fd);
+  ECONFIG.disk_size = st.st_size;
+  ECONFIG.savefrom = firstbad == -1 ? ECONFIG.numrows : firstbad;
+  ECONFIG.dirty = 0;
+
+  fileIdentityFromStat(&ECONFIG.undo.origin, &st);
+  ECONFIG.undo.history_checked = 0;
+  journalSetBase(filename, &st);
+  journalRecover();
+  editorSelectSyntax();
+  trigramOpen(filename, &st);
+  ECONFIG.diskseen = ECONFIG.undo.origin;
+  editorWatchFile();
+}
+
+/* Write rows [from, numrows) back to back starting at off, returns the end offset or -1 */
+off_t editorWriteRows(struct editorIO *io, int from, off_t off) {
+  char *buf[EDITOR_IO_DEPTH] = {NULL};
+  int k = 0, j;
+  size_t used = 0;
+  off_t ret = -1;
+
+  buf[0] = malloc(EDITOR_IO_CHUNK);
+  for (j = from; j <= ECONFIG.numrows; j++) {
+    int last = (j == ECONFIG.numrows);
+    editorRow *row = last ? NULL : &ECONFIG.row[j];
+
+    /* ship the staging buffer once it's full (or at the end) and move on to the next slot */
+    if (used > 0 && (last || used + row->size + 1 > EDITOR_IO_CHUNK)) {
+      ioSubmit(io, k, IO_WRITE, buf[k], used, off);
+      ioFlush(io);
+      off += used;
+      used = 0;
+      k = (k + 1) % EDITOR_IO_DEPTH;
+      if (buf[k] == NULL) buf[k] = malloc(EDITOR_IO_CHUNK);
+      if (ioWaitWrite(io, k) == -1) goto out;
+    }
+    if (last) break;
+
+    if ((size_t) row->size + 1 > EDITOR_IO_CHUNK) {
+      if (editorWriteAt(io->fd, row->chars, row->size, off) == -1) goto out;
+      if (editorWriteAt(io->fd, "\n", 1, off + row->size) == -1) goto out;
+      off += row->size + 1;
+      continue;
+    }
+    memcpy(&buf[k][used], row->chars, row->size);
+    used += row->size;
+    buf[k][used++] = '\n';
+  }
+  ret = off;
+
+out:
+  for (j = 0; j < EDITOR_IO_DEPTH; j++) {
+    if (ioWaitWrite(io, j) == -1) ret = -1;
+    if (io->slot[j].busy) io->slot[j].owned = buf[j]; /* still being written from */
+    else free(buf[j]);
+  }
+  return ret;
+}
+
+/*
+ * Only rows at or after ECONFIG.savefrom can differ from the file on disk. From there on,
+ * rows that still start at their old offset with their old length are patched in place,
+ * and everything after the first row that moved is rewritten up to the new end of file.
+ */
+void editorSave() {
+  if (ECONFIG.filename == NULL) {
+    ECONFIG.filename = editorPrompt("Save as: %s (ESC to cancel)", NULL);
+    if (ECONFIG.filename == NULL) {
+      editorSetStatusMessage("Save aborted");
+      return;
+    }
+    editorSelectSyntax();
+  }
+
+  struct editorIO io;
+  int fd = open(ECONFIG.filename, O_RDWR | O_CREAT, 0644);
+  if (fd == -1) goto fail;
+  ioInit(&io, fd);
+
+  struct stat st;
+  if (fstat(fd, &st) == -1) goto fail;
+
+  int changed = ECONFIG.disk_size >= 0 && !editorDiskUnchanged(&st);
+  if (changed && !editorConfirm("File changed on disk since it was read. Overwrite it? (y/n)")) {
+    ioFree(&io);
+    close(fd);
+    editorSetStatusMessage("Save aborted, Ctrl-O reloads the file");
+    return;
+  }
+
+  int from = ECONFIG.savefrom;
+  int rewrite = changed || st.st_size != ECONFIG.disk_size; /* not the file we loaded, write it all */
+  if (from > ECONFIG.numrows) from = ECONFIG.numrows;
+  if (rewrite) from = 0;
+
+  off_t off = 0;
+  if (from > 0) {
+    editorRow *prev = &ECONFIG.row[from - 1];
+    off = prev->disk_off + prev->disk_len + 1;
+  }
+
+  /* in-place patches are batched, a slot is only waited on when it comes round again */
+  off_t written = 0;
+  int tail = from;
+  int k = 0, j;
+  while (!rewrite && tail < ECONFIG.numrows) {
+    editorRow *row = &ECONFIG.row[tail];
+    if (row->disk_off != off || row->disk_len != row->size) break;
+    if (row->modified) {
+      if (ioWaitWrite(&io, k) == -1) goto fail;
+      struct iovec iov[2] = {{row->chars, row->size}, {"\n", 1}};
+      ioSubmit(&io, k, IO_WRITEV, iov, 2, off);
+      k = (k + 1) % EDITOR_IO_DEPTH;
+      if (k == 0) ioFlush(&io);
+      written += row->size + 1;
+    }
+    off += row->size + 1;
+    tail++;
+  }
+  ioFlush(&io);
+  for (j = 0; j < EDITOR_IO_DEPTH; j++) {
+    if (ioWaitWrite(&io, j) == -1) goto fail;
+  }
+
+  off_t len = editorWriteRows(&io, tail, off);
+  if (len == -1) goto fail;
+  written += len - off;
+  if (len != st.st_size && ftruncate(fd, len) == -1) goto fail;
+  if (fstat(fd, &st) == -1) goto fail;
+  ioFree(&io);
+  close(fd);
+  journalDiscard();
+  journalSetBase(ECONFIG.filename, &st);
+  undoSaveHistory(&st);
+  trigramDrop();
+
+  off = from > 0 ? ECONFIG.row[from - 1].disk_off + ECONFIG.row[from - 1].disk_len + 1 : 0;
+  for (j = from; j < ECONFIG.numrows; j++) {
+    ECONFIG.row[j].disk_off = off;
+    ECONFIG.row[j].disk_len = ECONFIG.row[j].size;
+    ECONFIG.row[j].modified = 0;
+    off += ECONFIG.row[j].size + 1;
+  }
+  ECONFIG.savefrom = ECONFIG.numrows;
+  ECONFIG.disk_size = len;
+  ECONFIG.dirty = 0;
+  ECONFIG.diskseen = ECONFIG.undo.origin;
+  editorWatchFile();
+  editorSetStatusMessage("%lld bytes written to disk (%lld rewritten)",
+    (long long) len, (long long) written);
+  return;
+
+fail:
+  if (fd != -1) {
+    int saved = errno;
+    ioFree(&io);
+    close(fd);
+    errno = saved;
+  }
+  editorSetStatusMessage("Can save! I/O error: %s", strerror(errno));
+}
+
+/*
+ * Changes made to the file by other programs. The file is watched with inotify (or its
+ * identity checked on every idle tick without it) and compared against the identity
+ * it had when it was read or saved. A clean buffer is brought up to date on the spot,
+ * a modified one only when asked to, and saving over a file that changed asks first.
+ *
+ * Reloading diffs the buffer against the new file and replaces only the rows in its
+ * hunks, as one undo group, so the cursor stays where it was and the reload can be
+ * undone like any other edit.
+ */
+
+/*
+ * Record for undo the replacement of rows [at, at + n) by newn rows holding text, their
+ * lines joined by '\n', as the text edits that undo and redo replay. The rows are left
+ * alone, see editorRebuildRows().
+ */
+void editorRecordReplace(int at, int n, const char *text, size_t len, int newn) {
+  int col = 0, j;
+  if (n > 0) {
+    int from = at;
+    size_t oldlen = n - 1;
+    for (j = at; j < at + n; j++) oldlen += ECONFIG.row[j].size;
+    if (newn == 0 && at + n < ECONFIG.numrows) {
+      oldlen++; /* and the break after the last row */
+    }
+    else if (newn == 0 && at > 0) {
+      from--; /* and the break before the first row */
+      col = ECONFIG.row[from].size;
+      oldlen++;
+    }
+    char *old = editorCopyText(from, col, oldlen);
+    undoRecord(UNDO_DELETE, from, col, old, oldlen);
+    free(old);
+    /* what is left is an empty row at `at` */
+    if (newn > 0) undoRecord(UNDO_INSERT, at, 0, text, len);
+    return;
+  }
+  if (newn == 0) return;
+
+  /* the new rows go in before row at, or after the last row */
+  char *buf = malloc(len + 1);
+  if (at < ECONFIG.numrows) {
+    memcpy(buf, text, len);
+    buf[len] = '\n';
+    undoRecord(UNDO_INSERT, at, 0, buf, len + 1);
+  }
+  else if (at > 0) {
+    buf[0] = '\n';
+    memcpy(buf + 1, text, len);
+    undoRecord(UNDO_INSERT, at - 1, ECONFIG.row[at - 1].size, buf, len + 1);
+  }
+  else {
+    undoRecord(UNDO_NEWROW, 0, 0, NULL, 0);
+    undoRecord(UNDO_INSERT, 0, 0, text, len);
+  }
+  free(buf);
+}
+
+/* Line j of a file split at lineoff, without its line break */
+int editorDiskLineLen(const char *map, const off_t *lineoff, int j) {
+  off_t len = lineoff[j + 1] - lineoff[j];
+  while (len > 0 && (map[lineoff[j] + len - 1] == '\n' || map[lineoff[j] + len - 1] == '\r')) len--;
+  return len;
+}
+
+int editorRowIsLine(editorRow *row, const char *map, const off_t *lineoff, int j) {
+  return row->size == editorDiskLineLen(map, lineoff, j) && memcmp(row->chars, map + lineoff[j], row->size) == 0;
+}
+
+/* Offsets of the lines of a file: line j is [lineoff[j], lineoff[j + 1]) including its line break */
+off_t *editorSplitLines(const char *map, off_t size, int *numlines) {
+  int n = 0, cap = 1024;
+  off_t *lineoff = malloc(sizeof(off_t) * cap);
+  off_t off = 0;
+  while (off < size) {
+    const char *nl = memchr(map + off, '\n', size - off);
+    if (n + 2 > cap) lineoff = realloc(lineoff, sizeof(off_t) * (cap *= 2));
+    lineoff[n++] = off;
+    off = nl ? nl - map + 1 : size;
+  }
+  lineoff[n] = size;
+  *numlines = n;
+  return lineoff;
+}
+
+/* Lines [first, first + n) of a file joined by '\n' */
+char *editorJoinLines(const char *map, const off_t *lineoff, int first, int n, size_t *len) {
+  size_t total = 0;
+  int j;
+  for (j = first; j < first + n; j++) total += editorDiskLineLen(map, lineoff, j) + 1;
+  char *text = malloc(total + 1), *p = text;
+  for (j = first; j < first + n; j++) {
+    int linelen = editorDiskLineLen(map, lineoff, j);
+    memcpy(p, map + lineoff[j], linelen);
+    p += linelen;
+    *p++ = '\n';
+  }
+  *len = total > 0 ? total - 1 : 0;
+  return text;
+}
+
+/* Fill in *dst as line j of a file, rendered outside the row array so the index is left alone */
+void editorRowFromLine(editorRow *dst, const char *map, const off_t *lineoff, int j) {
+  editorRow row;
+  editorInitRow(&row);
+  row.size = editorDiskLineLen(map, lineoff, j);
+  row.chars = malloc(row.size + 1);
+  memcpy(row.chars, map + lineoff[j], row.size);
+  row.chars[row.size] = '\0';
+  editorUpdateRow(&row);
+  *dst = row;
+}
+
+/*
+ * Put the lines of a file the diff marked in place of the rows it marked. A few hunks
+ * are spliced in from the bottom up, each moving the rows below it, more than
+ * EDITOR_DIFF_SPLICE get the row array built again in one pass. Emptying the buffer
+ * leaves an empty row, as deleting all of its text would.
+ */
+void editorRebuildRows(const char *map, const off_t *lineoff, int numlines, const unsigned char *changedrows, const unsigned char *changedlines) {
+  int i = 0, j = 0, k, h, numhunks = 0, hunkcap = 64, numrows = ECONFIG.numrows, newrows = numrows, grown = 0;
+  int (*hunks)[4] = malloc(sizeof(*hunks) * hunkcap); /* row, rows, line, lines */
+  while (i < numrows || j < numlines) {
+    if (i < numrows && j < numlines && !changedrows[i] && !changedlines[j]) {
+      i++;
+      j++;
+      continue;
+    }
+    if (numhunks == hunkcap) hunks = realloc(hunks, sizeof(*hunks) * (hunkcap *= 2));
+    hunks[numhunks][0] = i;
+    hunks[numhunks][2] = j;
+    while (i < numrows && changedrows[i]) i++;
+    while (j < numlines && changedlines[j]) j++;
+    hunks[numhunks][1] = i - hunks[numhunks][0];
+    hunks[numhunks][3] = j - hunks[numhunks][2];
+    if (hunks[numhunks][1] == 0 && hunks[numhunks][3] == 0) break; /* unchanged rows and lines always pair up */
+    newrows += hunks[numhunks][3] - hunks[numhunks][1];
+    if (hunks[numhunks][3] > hunks[numhunks][1]) grown += hunks[numhunks][3] - hunks[numhunks][1];
+    numhunks++;
+  }
+  if (numhunks == 0) {
+    free(hunks);
+    return;
+  }
+  editorBeginEdit();
+
+  if (numhunks <= EDITOR_DIFF_SPLICE) {
+    if (grown > 0) ECONFIG.row = realloc(ECONFIG.row, sizeof(editorRow) * (numrows + grown));
+    for (h = numhunks - 1; h >= 0; h--) {
+      int at = hunks[h][0], oldn = hunks[h][1], first = hunks[h][2], newn = hunks[h][3];
+      for (k = at; k < at + oldn; k++) editorFreeRow(&ECONFIG.row[k]);
+      memmove(&ECONFIG.row[at + newn], &ECONFIG.row[at + oldn], sizeof(editorRow) * (ECONFIG.numrows - at - oldn));
+      ECONFIG.numrows += newn - oldn;
+      for (k = 0; k < newn; k++) editorRowFromLine(&ECONFIG.row[at + k], map, lineoff, first + k);
+    }
+  }
+  else {
+    editorRow *rows = malloc(sizeof(editorRow) * (newrows + 1));
+    for (i = k = h = 0; i < numrows; h++) {
+      int end = h < numhunks ? hunks[h][0] : numrows;
+      memcpy(&rows[k], &ECONFIG.row[i], sizeof(editorRow) * (end - i));
+      k += end - i;
+      if (h == numhunks) break;
+      for (i = end; i < end + hunks[h][1]; i++) editorFreeRow(&ECONFIG.row[i]);
+      for (j = 0; j < hunks[h][3]; j++) editorRowFromLine(&rows[k++], map, lineoff, hunks[h][2] + j);
+    }
+    for (; h < numhunks; h++) { /* lines added at the end */
+      for (j = 0; j < hunks[h][3]; j++) editorRowFromLine(&rows[k++], map, lineoff, hunks[h][2] + j);
+    }
+    free(ECONFIG.row);
+    ECONFIG.row = rows;
+    ECONFIG.numrows = newrows;
+  }
+  if (ECONFIG.numrows == 0 && numrows > 0) {
+    editorRow row;
+    editorInitRow(&row);
+    row.chars = calloc(1, 1);
+    editorUpdateRow(&row);
+    ECONFIG.row = realloc(ECONFIG.row, sizeof(editorRow));
+    ECONFIG.row[0] = row;
+    ECONFIG.numrows = 1;
+    hunks[numhunks - 1][3]++;
+  }
+  editorTouchRows(hunks[0][0]);
+  ECONFIG.dirty++;
+
+  /* the index takes the hunks from the top, each one where the ones above moved it */
+  int shift = 0;
+  for (h = 0; ECONFIG.rowindex.built && h < numhunks; h++) {
+    if (hunks[h][1] > 0) rowIndexDelete(hunks[h][0] + shift, hunks[h][1]);
+    if (hunks[h][3] > 0) rowIndexInsert(hunks[h][0] + shift, hunks[h][3]);
+    shift += hunks[h][3] - hunks[h][1];
+  }
+  free(hunks);
+}
+
+/* Make the buffer match the file on disk, returns the number of rows replaced or -1 */
+int editorReload() {
+  int fd = open(ECONFIG.filename, O_RDONLY);
+  struct stat st;
+  if (fd == -1 || fstat(fd, &st) == -1) {
+    editorSetStatusMessage("Can't reload: %s", strerror(errno));
+    if (fd != -1) close(fd);
+    return -1;
+  }
+  char *map = NULL;
+  if (st.st_size > 0 && (map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+    editorSetStatusMessage("Can't reload: %s", strerror(errno));
+    close(fd);
+    return -1;
+  }
+
+  int numlines, i, j, rows = 0;
+  off_t *lineoff = editorSplitLines(map, st.st_size, &numlines);
+  unsigned char *changedrows = calloc(ECONFIG.numrows + 1, 1), *changedlines = calloc(numlines + 1, 1);
+  diffRowsWithFile(map, lineoff, numlines, changedrows, changedlines);
+
+  /* each hunk is recorded for undo from the bottom up, so the rows of the ones above stay put */
+  i = ECONFIG.numrows;
+  j = numlines;
+  while (i > 0 || j > 0) {
+    if (i > 0 && j > 0 && !changedrows[i - 1] && !changedlines[j - 1]) {
+      i--;
+      j--;
+      continue;
+    }
+    int oldend = i, newend = j;
+    while ((i > 0 && changedrows[i - 1]) || (j > 0 && changedlines[j - 1])) {
+      if (i > 0 && changedrows[i - 1]) i--;
+      else j--;
+    }
+    if (i == oldend && j == newend) break; /* unchanged rows and lines always pair up */
+    if (rows == 0) {
+      /* the history saved with the old file comes before the reload, or not at all */
+      undoLoadHistory();
+      undoBreak();
+      ECONFIG.undo.bulk = 1;
+    }
+    size_t len;
+    char *text = editorJoinLines(map, lineoff, j, newend - j, &len);
+    editorRecordReplace(i, oldend - i, text, len, newend - j);
+    free(text);
+
+    int oldn = oldend - i, newn = newend - j;
+    if (ECONFIG.cy >= i + oldn) ECONFIG.cy += newn - oldn;
+    else if (ECONFIG.cy >= i + newn) ECONFIG.cy = newn > 0 ? i + newn - 1 : i;
+    rows += oldn > newn ? oldn : newn;
+  }
+  if (rows > 0) {
+    editorRebuildRows(map, lineoff, numlines, changedrows, changedlines);
+    ECONFIG.undo.bulk = 0;
+    undoBreak();
+    editorClampCursor();
+  }
+  free(changedrows);
+  free(changedlines);
+
+  /* every row now sits where the file has it */
+  int firstbad = -1;
+  for (j = 0; j < ECONFIG.numrows && j < numlines; j++) {
+    editorRow *row = &ECONFIG.row[j];
+    off_t rawlen = lineoff[j + 1] - lineoff[j];
+    row->disk_off = lineoff[j];
+    row->disk_len = row->size;
+    row->modified = rawlen != row->size + 1 || map[lineoff[j] + row->size] != '\n';
+    if (row->modified && firstbad == -1) firstbad = j;
+  }
+  for (; j < ECONFIG.numrows; j++) { /* the file was empty, a row was kept */
+    ECONFIG.row[j].modified = 1;
+    if (firstbad == -1) firstbad = j;
+  }
+  ECONFIG.savefrom = firstbad == -1 ? ECONFIG.numrows : firstbad;
+  ECONFIG.disk_size = st.st_size;
+  ECONFIG.dirty = 0;
+  fileIdentityFromStat(&ECONFIG.undo.origin, &st);
+  ECONFIG.diskseen = ECONFIG.undo.origin;
+  journalDiscard();
+  journalSetBase(ECONFIG.filename, &st);
+
+  free(lineoff);
+  if (map) munmap(map, st.st_size);
+  close(fd);
+  return rows;
+}
+
+/* Start watching ECONFIG.filename for changes made by others */
+void editorWatchFile() {
+#ifdef EDITOR_HAVE_INOTIFY
+  if (ECONFIG.diskwatch == -1) ECONFIG.diskwatch = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+  if (ECONFIG.diskwatch != -1 && ECONFIG.filename) {
+    inotify_add_watch(ECONFIG.diskwatch, ECONFIG.filename, IN_MODIFY | IN_ATTRIB | IN_MOVE_SELF | IN_DELETE_SELF);
+  }
+#endif
+}
+
+/* Whether the file on disk is still the one the buffer was read from or saved to */
+int editorDiskUnchanged(struct stat *st) {
+  struct fileIdentity id;
+  fileIdentityFromStat(&id, st);
+  return memcmp(&id, &ECONFIG.undo.origin, sizeof(id)) == 0;
+}
+
+/* Called when idle: notices changes made to the file by others, returns 1 if the screen changed */
+int editorCheckDisk() {
+  if (ECONFIG.filename == NULL || ECONFIG.disk_size < 0 || ECONFIG.view.active || ECONFIG.compare.active) return 0;
+#ifdef EDITOR_HAVE_INOTIFY
+  if (ECONFIG.diskwatch != -1) {
+    char buf[4096];
+    int events = 0;
+    while (read(ECONFIG.diskwatch, buf, sizeof(buf)) > 0) events = 1;
+    if (!events) return 0;
+  }
+#endif
+  struct stat st;
+  struct fileIdentity id;
+  if (stat(ECONFIG.filename, &st) == -1) {
+    if (ECONFIG.diskseen.ino == 0) return 0;
+    memset(&ECONFIG.diskseen, 0, sizeof(ECONFIG.diskseen));
+    editorSetStatusMessage("%s was removed on disk, Ctrl-S writes it again", ECONFIG.filename);
+    return 1;
+  }
+  fileIdentityFromStat(&id, &st);
+  if (editorDiskUnchanged(&st) || memcmp(&id, &ECONFIG.diskseen, sizeof(id)) == 0) return 0;
+  if (id.ino != ECONFIG.diskseen.ino) editorWatchFile(); /* replaced by a new file */
+  ECONFIG.diskseen = id;
+
+  if (ECONFIG.dirty) {
+    editorSetStatusMessage("File changed on disk: Ctrl-O reloads it (undoable), Ctrl-S overwrites it");
+    return 1;
+  }
+  int rows = editorReload();
+  if (rows >= 0) editorSetStatusMessage("Reloaded, %d rows changed on disk", rows);
+  return 1;
+}
+
+/*** regex ***/
+
+/*
+ * Regular expressions for the find prompt. A pattern is parsed into a tree, compiled
+ * into a Thompson NFA (twice: once forwards and once reversed) and run as a DFA whose
+ * states are built lazily from sets of NFA instructions and cached, so matching is
+ * linear in the row length whatever the pattern looks like. Supported: literals, .,
+ * [] classes with ranges, \d \w \s and their negations, ( ) | * + ? {m,n} ^ $.
+ *
+ * Matches are leftmost-longest like grep -E. A reversed unanchored pass over the row
+ * flags every column where a match begins, then an anchored forward pass from the
+ * first flagged column finds where it ends. A literal that every match must contain
+ * is extracted from the tree so rows without it are skipped by editorFindBytes().
+ */
+
+enum regexNodeType {
+  RE_CLASS = 1,
+  RE_CAT,
+  RE_ALT,
+  RE_STAR,
+  RE_PLUS,
+  RE_QUEST,
+  RE_EMPTY,
+  RE_BOL,
+  RE_EOL
+};
+
+struct regexNode {
+  int type;
+  int a, b; /* children */
+  int set; /* RE_CLASS: index into sets */
+};
+
+struct regexParser {
+  const char *p;
+  struct regexNode *nodes;
+  int numnodes, nodecap;
+  unsigned char (*sets)[32];
+  int numsets, setcap;
+  const char *error;
+};
+
+int regexNewNode(struct regexParser *ps, int type, int a, int b) {
+  if (ps->numnodes == EDITOR_REGEX_NODES) {
+    ps->error = "pattern too big";
+    return -1;
+  }
+  if (ps->numnodes == ps->nodecap) {
+    ps->nodecap = ps->nodecap ? ps->nodecap * 2 : 64;
+    ps->nodes = realloc(ps->nodes, sizeof(struct regexNode) * ps->nodecap);
+  }
+  struct regexNode *n = &ps->nodes[ps->numnodes];
+  n->type = type;
+  n->a = a;
+  n->b = b;
+  n->set = -1;
+  return ps->numnodes++;
+}
+
+int regexNewClass(struct regexParser *ps) {
+  int node = regexNewNode(ps, RE_CLASS, -1, -1);
+  if (node == -1) return -1;
+  if (ps->numsets == ps->setcap) {
+    ps->setcap = ps->setcap ? ps->setcap * 2 : 16;
+    ps->sets = realloc(ps->sets, sizeof(ps->sets[0]) * ps->setcap);
+  }
+  memset(ps->sets[ps->numsets], 0, 32);
+  ps->nodes[node].set = ps->numsets++;
+  return node;
+}
+
+void regexSetAdd(unsigned char *set, int from, int to) {
+  int c;
+  for (c = from; c <= to; c++) set[c >> 3] |= 1 << (c & 7);
+}
+
+/* Add the class named by the escape \c to set, returns 0 if c is not a class escape */
+int regexEscapeClass(unsigned char *set, int c) {
+  unsigned char tmp[32];
+  int j;
+  memset(tmp, 0, sizeof(tmp));
+  switch (tolower(c)) {
+    case 'd': regexSetAdd(tmp, '0', '9'); break;
+    case 'w': regexSetAdd(tmp, '0', '9'); regexSetAdd(tmp, 'a', 'z'); regexSetAdd(tmp, 'A', 'Z'); regexSetAdd(tmp, '_', '_'); break;
+    case 's': regexSetAdd(tmp, ' ', ' '); regexSetAdd(tmp, '\t', '\r'); break;
+    default: return 0;
+  }
+  for (j = 0; j < 32; j++) set[j] |= isupper(c) ? ~tmp[j] : tmp[j];
+  return 1;
+}
+
+int regexEscapeChar(int c) {
+  switch (c) {
+    case 't': return '\t';
+    case 'n': return '\n';
+    case 'r': return '\r';
+    default: return c;
+  }
+}
+
+int regexParseAlt(struct regexParser *ps);
+
+/* [...] with the opening bracket already consumed */
+int regexParseClass(struct regexParser *ps) {
+  int node = regexNewClass(ps);
+  if (node == -1) return -1;
+  unsigned char *set = ps->sets[ps->nodes[node].set];
+  int negate = 0, first = 1, j;
+
+  if (*ps->p == '^') {
+    negate = 1;
+    ps->p++;
+  }
+  while (*ps->p != ']' || first) {
+    int c = (unsigned char) *ps->p++;
+    first = 0;
+    if (c == '\0') {
+      ps->error = "missing ]";
+      return -1;
+    }
+    if (c == '\\' && *ps->p) {
+      c = (unsigned char) *ps->p++;
+      if (regexEscapeClass(set, c)) continue;
+      c = regexEscapeChar(c);
+    }
+    int to = c;
+    if (ps->p[0] == '-' && ps->p[1] != ']' && ps->p[1] != '\0') {
+      to = (unsigned char) ps->p[1];
+      ps->p += 2;
+      if (to == '\\' && *ps->p) to = regexEscapeChar((unsigned char) *ps->p++);
+      if (to < c) {
+        ps->error = "bad range";
+        return -1;
+      }
+    }
+    regexSetAdd(set, c, to);
+  }
+  ps->p++;
+  if (negate) {
+    for (j = 0; j < 32; j++) set[j] = ~set[j];
+  }
+  return node;
+}
+
+int regexParseAtom(struct regexParser *ps) {
+  int c = (unsigned char) *ps->p++;
+  int node;
+
+  switch (c) {
+    case '(':
+      node = regexParseAlt(ps);
+      if (node == -1) return -1;
+      if (*ps->p != ')') {
+        ps->error = "missing )";
+        return -1;
+      }
+      ps->p++;
+      return node;
+    case '[':
+      return regexParseClass(ps);
+    case '^':
+      return regexNewNode(ps, RE_BOL, -1, -1);
+    case '$':
+      return regexNewNode(ps, RE_EOL, -1, -1);
+    case '*': case '+': case '?': case '{':
+      ps->error = "nothing to repeat";
+      return -1;
+  }
+
+  node = regexNewClass(ps);
+  if (node == -1) return -1;
+  unsigned char *set = ps->sets[ps->nodes[node].set];
+  if (c == '.') {
+    regexSetAdd(set, 0, 255);
+  }
+  else if (c == '\\') {
+    if (*ps->p == '\0') {
+      ps->error = "trailing \\";
+      return -1;
+    }
+    c = (unsigned char) *ps->p++;
+    if (!regexEscapeClass(set, c)) regexSetAdd(set, regexEscapeChar(c), regexEscapeChar(c));
+  }
+  else {
+    regexSetAdd(set, c, c);
+  }
+  return node;
+}
+
+/* Deep copy of a subtree, used to expand counted repetitions */
+int regexCopyNode(struct regexParser *ps, int node) {
+  struct regexNode n = ps->nodes[node];
+  int a = n.a, b = n.b;
+  if (a != -1 && (a = regexCopyNode(ps, a)) == -1) return -1;
+  if (b != -1 && (b = regexCopyNode(ps, b)) == -1) return -1;
+  int copy = regexNewNode(ps, n.type, a, b);
+  if (copy != -1) ps->nodes[copy].set = n.set;
+  return copy;
+}
+
+/* x{min,max} as min copies of x followed by max - min copies of x?, max -1 is unbounded */
+int regexRepeat(struct regexParser *ps, int node, int min, int max) {
+  int result = -1, j;
+  for (j = 0; j < min || (max == -1 ? j == min : j < max); j++) {
+    int copy = j == 0 ? node : regexCopyNode(ps, node);
+    if (copy == -1) return -1;
+    if (j >= min) copy = regexNewNode(ps, max == -1 ? RE_STAR : RE_QUEST, copy, -1);
+    result = result == -1 ? copy : regexNewNode(ps, RE_CAT, result, copy);
+    if (copy == -1 || result == -1) return -1;
+  }
+  return result == -1 ? regexNewNode(ps, RE_EMPTY, -1, -1) : result;
+}
+
+int regexParseCount(struct regexParser *ps) {
+  if (!isdigit((unsigned char) *ps->p)) return -1;
+  int n = 0;
+  while (isdigit((unsigned char) *ps->p) && n <= 1000) n = n * 10 + *ps->p++ - '0';
+  return n;
+}
+
+int regexParseRepeat(struct regexParser *ps) {
+  int node = regexParseAtom(ps);
+
+  while (node != -1) {
+    char c = *ps->p;
+    if (c == '*') node = regexNewNode(ps, RE_STAR, node, -1);
+    else if (c == '+') node = regexNewNode(ps, RE_PLUS, node, -1);
+    else if (c == '?') node = regexNewNode(ps, RE_QUEST, node, -1);
+    else if (c == '{') {
+      ps->p++;
+      int min = regexParseCount(ps), max = min;
+      if (*ps->p == ',') {
+        ps->p++;
+        max = *ps->p == '}' ? -1 : regexParseCount(ps);
+      }
+      if (min == -1 || *ps->p != '}' || (max != -1 && max < min) || min > 255 || max > 255) {
+        ps->error = "bad {m,n}";
+        return -1;
+      }
+      node = regexRepeat(ps, node, min, max);
+    }
+    else break;
+    ps->p++;
+  }
+  return node;
+}
+
+int regexParseCat(struct regexParser *ps) {
+  int node = -1;
+  while (*ps->p != '\0' && *ps->p != '|' && *ps->p != ')') {
+    int next = regexParseRepeat(ps);
+    if (next == -1) return -1;
+    node = node == -1 ? next : regexNewNode(ps, RE_CAT, node, next);
+    if (node == -1) return -1;
+  }
+  return node == -1 ? regexNewNode(ps, RE_EMPTY, -1, -1) : node;
+}
+
+int regexParseAlt(struct regexParser *ps) {
+  int node = regexParseCat(ps);
+  while (node != -1 && *ps->p == '|') {
+    ps->p++;
+    int next = regexParseCat(ps);
+    if (next == -1) return -1;
+    node = regexNewNode(ps, RE_ALT, node, next);
+  }
+  return node;
+}
+
+/*
+ * Literal strings implied by a subtree: every match equals `exact` (when exactlen is
+ * not -1), starts with `prefix`, ends with `suffix` and contains `best`. Strings longer
+ * than EDITOR_REGEX_LITERAL are cut, which keeps them true for prefix/suffix/best.
+ */
+struct regexLiteral {
+  int exactlen, prefixlen, suffixlen, bestlen;
+  char exact[EDITOR_REGEX_LITERAL], prefix[EDITOR_REGEX_LITERAL];
+  char suffix[EDITOR_REGEX_LITERAL], best[EDITOR_REGEX_LITERAL];
+};
+
+void regexLiteralBest(struct regexLiteral *l, const char *s, int len) {
+  if (len > l->bestlen) {
+    memcpy(l->best, s, len);
+    l->bestlen = len;
+  }
+}
+
+void regexLiterals(struct regexParser *ps, int node, struct regexLiteral *l) {
+  struct regexNode *n = &ps->nodes[node];
+  struct regexLiteral a, b;
+  int j;
+
+  memset(l, 0, sizeof(*l));
+  l->exactlen = -1;
+  switch (n->type) {
+    case RE_EMPTY: case RE_BOL: case RE_EOL:
+      l->exactlen = 0;
+      break;
+    case RE_CLASS: {
+      unsigned char *set = ps->sets[n->set];
+      int count = 0, c = 0;
+      for (j = 0; j < 256; j++) {
+        if (set[j >> 3] & (1 << (j & 7))) {
+          count++;
+          c = j;
+        }
+      }
+      if (count == 1) {
+        l->exact[0] = l->prefix[0] = l->suffix[0] = l->best[0] = c;
+        l->exactlen = l->prefixlen = l->suffixlen = l->bestlen = 1;
+      }
+      break;
+    }
+    case RE_PLUS:
+      regexLiterals(ps, n->a, l);
+      if (l->exactlen > 0) {
+        memcpy(l->prefix, l->exact, l->exactlen);
+        memcpy(l->suffix, l->exact, l->exactlen);
+        memcpy(l->best, l->exact, l->exactlen);
+        l->prefixlen = l->suffixlen = l->bestlen = l->exactlen;
+      }
+      l->exactlen = -1;
+      break;
+    case RE_ALT:
+      regexLiterals(ps, n->a, &a);
+      regexLiterals(ps, n->b, &b);
+      if (a.exactlen != -1 && a.exactlen == b.exactlen && memcmp(a.exact, b.exact, a.exactlen) == 0) {
+        *l = a;
+        break;
+      }
+      while (l->prefixlen < a.prefixlen && l->prefixlen < b.prefixlen &&
+             a.prefix[l->prefixlen] == b.prefix[l->prefixlen]) {
+        l->prefix[l->prefixlen] = a.prefix[l->prefixlen];
+        l->prefixlen++;
+      }
+      while (l->suffixlen < a.suffixlen && l->suffixlen < b.suffixlen &&
+             a.suffix[a.suffixlen - l->suffixlen - 1] == b.suffix[b.suffixlen - l->suffixlen - 1]) {
+        l->suffixlen++;
+      }
+      memcpy(l->suffix, &a.suffix[a.suffixlen - l->suffixlen], l->suffixlen);
+      regexLiteralBest(l, l->prefix, l->prefixlen);
+      regexLiteralBest(l, l->suffix, l->suffixlen);
+      break;
+    case RE_CAT: {
+      char joined[EDITOR_REGEX_LITERAL * 2];
+      regexLiterals(ps, n->a, &a);
+      regexLiterals(ps, n->b, &b);
+
+      if (a.exactlen != -1 && b.exactlen != -1 && a.exactlen + b.exactlen <= EDITOR_REGEX_LITERAL) {
+        memcpy(l->exact, a.exact, a.exactlen);
+        memcpy(&l->exact[a.exactlen], b.exact, b.exactlen);
+        l->exactlen = a.exactlen + b.exactlen;
+      }
+      if (a.exactlen != -1) {
+        memcpy(joined, a.exact, a.exactlen);
+        memcpy(&joined[a.exactlen], b.prefix, b.prefixlen);
+        l->prefixlen = a.exactlen + b.prefixlen;
+        if (l->prefixlen > EDITOR_REGEX_LITERAL) l->prefixlen = EDITOR_REGEX_LITERAL;
+        memcpy(l->prefix, joined, l->prefixlen);
+      }
+      else {
+        memcpy(l->prefix, a.prefix, a.prefixlen);
+        l->prefixlen = a.prefixlen;
+      }
+      if (b.exactlen != -1) {
+        memcpy(joined, a.suffix, a.suffixlen);
+        memcpy(&joined[a.suffixlen], b.exact, b.exactlen);
+        l->suffixlen = a.suffixlen + b.exactlen;
+        if (l->suffixlen > EDITOR_REGEX_LITERAL) l->suffixlen = EDITOR_REGEX_LITERAL;
+        memcpy(l->suffix, &joined[a.suffixlen + b.exactlen - l->suffixlen], l->suffixlen);
+      }
+      else {
+        memcpy(l->suffix, b.suffix, b.suffixlen);
+        l->suffixlen = b.suffixlen;
+      }
+
+      regexLiteralBest(l, a.best, a.bestlen);
+      regexLiteralBest(l, b.best, b.bestlen);
+      memcpy(joined, a.suffix, a.suffixlen);
+      memcpy(&joined[a.suffixlen], b.prefix, b.prefixlen);
+      regexLiteralBest(l, joined, a.suffixlen + b.prefixlen > EDITOR_REGEX_LITERAL ?
+        EDITOR_REGEX_LITERAL : a.suffixlen + b.prefixlen);
+      regexLiteralBest(l, l->prefix, l->prefixlen);
+      regexLiteralBest(l, l->suffix, l->suffixlen);
+      break;
+    }
+  }
+}
+
+int regexEmit(struct regex *re, int op, int x, int y) {
+  if (re->numinsts[re->building] == re->instcap) {
+    re->instcap = re->instcap ? re->instcap * 2 : 64;
+    re->insts[0] = realloc(re->insts[0], sizeof(struct regexInst) * re->instcap);
+    re->insts[1] = realloc(re->insts[1], sizeof(struct regexInst) * re->instcap);
+  }
+  struct regexInst *inst = &re->insts[re->building][re->numinsts[re->building]];
+  inst->op = op;
+  inst->x = x;
+  inst->y = y;
+  return re->numinsts[re->building]++;
+}
+
+/* Thompson construction; with reverse set the program matches the reversed strings */
+void regexCompileNode(struct regex *re, struct regexParser *ps, int node, int reverse) {
+  struct regexNode *n = &ps->nodes[node];
+  struct regexInst *insts;
+  int split, jmp;
+
+  switch (n->type) {
+    case RE_CLASS:
+      regexEmit(re, RI_CLASS, n->set, 0);
+      break;
+    case RE_BOL:
+      regexEmit(re, reverse ? RI_END : RI_BEGIN, 0, 0);
+      break;
+    case RE_EOL:
+      regexEmit(re, reverse ? RI_BEGIN : RI_END, 0, 0);
+      break;
+    case RE_CAT:
+      regexCompileNode(re, ps, reverse ? n->b : n->a, reverse);
+      regexCompileNode(re, ps, reverse ? n->a : n->b, reverse);
+      break;
+    case RE_ALT:
+      split = regexEmit(re, RI_SPLIT, 0, 0);
+      regexCompileNode(re, ps, n->a, reverse);
+      jmp = regexEmit(re, RI_JMP, 0, 0);
+      regexCompileNode(re, ps, n->b, reverse);
+      insts = re->insts[re->building];
+      insts[split].x = split + 1;
+      insts[split].y = jmp + 1;
+      insts[jmp].x = re->numinsts[re->building];
+      break;
+    case RE_STAR:
+      split = regexEmit(re, RI_SPLIT, 0, 0);
+      regexCompileNode(re, ps, n->a, reverse);
+      regexEmit(re, RI_JMP, split, 0);
+      insts = re->insts[re->building];
+      insts[split].x = split + 1;
+      insts[split].y = re->numinsts[re->building];
+      break;
+    case RE_PLUS:
+      jmp = re->numinsts[re->building];
+      regexCompileNode(re, ps, n->a, reverse);
+      split = regexEmit(re, RI_SPLIT, jmp, 0);
+      re->insts[re->building][split].y = split + 1;
+      break;
+    case RE_QUEST:
+      split = regexEmit(re, RI_SPLIT, 0, 0);
+      regexCompileNode(re, ps, n->a, reverse);
+      insts = re->insts[re->building];
+      insts[split].x = split + 1;
+      insts[split].y = re->numinsts[re->building];
+      break;
+  }
+}
+
+/* Compile pattern, returns NULL and points *error at a message when it is malformed */
+struct regex *regexCompile(const char *pattern, const char **error) {
+  struct regexParser ps;
+  memset(&ps, 0, sizeof(ps));
+  ps.p = pattern;
+
+  int root = regexParseAlt(&ps);
+  if (root != -1 && *ps.p != '\0') {
+    ps.error = "unmatched )";
+    root = -1;
+  }
+  if (root == -1) {
+    *error = ps.error;
+    free(ps.nodes);
+    free(ps.sets);
+    return NULL;
+  }
+
+  struct regex *re = calloc(1, sizeof(struct regex));
+  for (re->building = 0; re->building < 2; re->building++) {
+    regexCompileNode(re, &ps, root, re->building);
+    regexEmit(re, RI_MATCH, 0, 0);
+  }
+  re->sets = ps.sets;
+
+  struct regexLiteral lit;
+  regexLiterals(&ps, root, &lit);
+  memcpy(re->literal, lit.best, lit.bestlen);
+  re->literallen = lit.bestlen;
+
+  free(ps.nodes);
+  return re;
+}
+
+void regexFree(struct regex *re) {
+  if (re == NULL) return;
+  free(re->insts[0]);
+  free(re->insts[1]);
+  free(re->sets);
+  free(re);
+}
+
+/* Lazily built DFA over one of the programs of re; unanchored DFAs may start a match at every byte */
+void regexDFAInit(struct regexDFA *d, struct regex *re, int reverse, int unanchored) {
+  memset(d, 0, sizeof(*d));
+  d->re = re;
+  d->insts = re->insts[reverse];
+  d->numinsts = re->numinsts[reverse];
+  d->unanchored = unanchored;
+  d->mark = calloc(d->numinsts, sizeof(unsigned));
+  d->stack = malloc(sizeof(int) * d->numinsts);
+  d->list = malloc(sizeof(int) * d->numinsts);
+  d->tmp = malloc(sizeof(int) * d->numinsts);
+  d->start[0] = d->start[1] = -1;
+}
+
+void regexDFAFree(struct regexDFA *d) {
+  free(d->next);
+  free(d->flags);
+  free(d->setoff);
+  free(d->pool);
+  free(d->hash);
+  free(d->mark);
+  free(d->stack);
+  free(d->list);
+  free(d->tmp);
+  memset(d, 0, sizeof(*d));
+}
+
+/* Add pc and all instructions reachable from it without consuming a byte to list */
+void regexClosure(struct regexDFA *d, int *list, int *n, int pc, int atbegin, int atend) {
+  int sp = 0;
+  if (d->mark[pc] == d->gen) return;
+  d->mark[pc] = d->gen;
+  d->stack[sp++] = pc;
+
+  while (sp > 0) {
+    const struct regexInst *inst = &d->insts[pc = d->stack[--sp]];
+    int follow[2], nfollow = 0, j;
+    switch (inst->op) {
+      case RI_CLASS: case RI_MATCH:
+        list[(*n)++] = pc;
+        break;
+      case RI_JMP:
+        follow[nfollow++] = inst->x;
+        break;
+      case RI_SPLIT:
+        follow[nfollow++] = inst->y;
+        follow[nfollow++] = inst->x;
+        break;
+      case RI_BEGIN:
+        if (atbegin) follow[nfollow++] = pc + 1;
+        break;
+      case RI_END:
+        if (atend) follow[nfollow++] = pc + 1;
+        else list[(*n)++] = pc; /* may still match if the input ends here */
+        break;
+    }
+    for (j = 0; j < nfollow; j++) {
+      if (d->mark[follow[j]] == d->gen) continue;
+      d->mark[follow[j]] = d->gen;
+      d->stack[sp++] = follow[j];
+    }
+  }
+}
+
+int regexComparePc(const void *a, const void *b) {
+  return *(const int *) a - *(const int *) b;
+}
+
+uint32_t regexHashSet(const int *set, int n) {
+  uint32_t h = 2166136261u;
+  int j;
+  for (j = 0; j < n; j++) h = (h ^ (uint32_t) set[j]) * 16777619u;
+  return h;
+}
+
+/* Forget every state, the cache is rebuilt from scratch as the input demands */
+void regexDFAFlush(struct regexDFA *d) {
+  d->numstates = 0;
+  d->poollen = 0;
+  d->start[0] = d->start[1] = -1;
+  d->flushes++;
+  memset(d->hash, 0xff, sizeof(int) * d->hashcap);
+}
+
+/* State for the instruction set in d->list, adding it to the cache if it is new */
+int regexDFAState(struct regexDFA *d, int n) {
+  qsort(d->list, n, sizeof(int), regexComparePc);
+  uint32_t h = regexHashSet(d->list, n);
+  int j;
+
+  if (d->hashcap == 0) {
+    d->statecap = 64;
+    d->hashcap = EDITOR_REGEX_STATES * 2;
+    d->next = malloc(sizeof(int) * 256 * d->statecap);
+    d->flags = malloc(d->statecap);
+    d->setoff = malloc(sizeof(int) * (d->statecap + 1));
+    d->hash = malloc(sizeof(int) * d->hashcap);
+    regexDFAFlush(d);
+  }
+
+  for (j = h & (d->hashcap - 1); d->hash[j] != -1; j = (j + 1) & (d->hashcap - 1)) {
+    int s = d->hash[j];
+    if (d->setoff[s + 1] - d->setoff[s] == n && memcmp(&d->pool[d->setoff[s]], d->list, sizeof(int) * n) == 0) {
+      return s;
+    }
+  }
+
+  if (d->numstates == EDITOR_REGEX_STATES) {
+    regexDFAFlush(d);
+    for (j = h & (d->hashcap - 1); d->hash[j] != -1; j = (j + 1) & (d->hashcap - 1));
+  }
+  if (d->numstates == d->statecap) {
+    d->statecap *= 2;
+    d->next = realloc(d->next, sizeof(int) * 256 * d->statecap);
+    d->flags = realloc(d->flags, d->statecap);
+    d->setoff = realloc(d->setoff, sizeof(int) * (d->statecap + 1));
+  }
+  if (d->poollen + n > d->poolcap) {
+    d->poolcap = (d->poollen + n) * 2;
+    d->pool = realloc(d->pool, sizeof(int) * d->poolcap);
+  }
+
+  int s = d->numstates++;
+  memcpy(&d->pool[d->poollen], d->list, sizeof(int) * n);
+  d->setoff[s] = d->poollen;
+  d->poollen += n;
+  d->setoff[s + 1] = d->poollen;
+  d->hash[j] = s;
+  memset(&d->next[s * 256], 0xff, sizeof(int) * 256);
+
+  /* match flags: now, or only if the input ends here; dead when nothing can match anymore */
+  int flags = n == 0 && !d->unanchored ? REGEX_DEAD : 0, tn = 0;
+  d->gen++;
+  for (j = 0; j < n; j++) {
+    const struct regexInst *inst = &d->insts[d->list[j]];
+    if (inst->op == RI_MATCH) flags |= REGEX_MATCH | REGEX_MATCHEND;
+    if (inst->op == RI_END) regexClosure(d, d->tmp, &tn, d->list[j] + 1, 0, 1);
+  }
+  for (j = 0; j < tn; j++) {
+    if (d->insts[d->tmp[j]].op == RI_MATCH) flags |= REGEX_MATCHEND;
+  }
+  d->flags[s] = flags;
+  return s;
+}
+
+int regexDFAStart(struct regexDFA *d, int atbegin) {
+  if (d->start[atbegin] == -1) {
+    int n = 0;
+    d->gen++;
+    regexClosure(d, d->list, &n, 0, atbegin, 0);
+    d->start[atbegin] = regexDFAState(d, n);
+  }
+  return d->start[atbegin];
+}
+
+/* Transition out of state s on byte c, computed the first time it is taken */
+int regexDFAStep(struct regexDFA *d, int s, unsigned char c) {
+  int next = d->next[s * 256 + c];
+  if (next != -1) return next;
+
+  int from = d->setoff[s], to = d->setoff[s + 1], n = 0, j;
+  unsigned flushes = d->flushes;
+  d->gen++;
+  for (j = from; j < to; j++) {
+    const struct regexInst *inst = &d->insts[d->pool[j]];
+    if (inst->op == RI_CLASS && (d->re->sets[inst->x][c >> 3] & (1 << (c & 7)))) {
+      regexClosure(d, d->list, &n, d->pool[j] + 1, 0, 0);
+    }
+  }
+  if (d->unanchored) regexClosure(d, d->list, &n, 0, 0, 0);
+
+  next = regexDFAState(d, n);
+  if (d->flushes == flushes) d->next[s * 256 + c] = next; /* else s is gone */
+  return next;
+}
+
+/* End of the longest match that starts at s[at], or -1 */
+int regexLongest(struct regexDFA *d, const char *s, int n, int at) {
+  int state = regexDFAStart(d, at == 0);
+  int end = d->flags[state] & REGEX_MATCH ? at : -1;
+  int j;
+
+  for (j = at; j < n; j++) {
+    state = regexDFAStep(d, state, s[j]);
+    if (d->flags[state] & REGEX_DEAD) return end;
+    if (d->flags[state] & REGEX_MATCH) end = j + 1;
+  }
+  if (d->flags[state] & REGEX_MATCHEND) end = n;
+  return end;
+}
+
+/* starts[j] is set when some match begins at column j, found scanning s backwards */
+void regexStarts(struct regexDFA *d, const char *s, int n, unsigned char *starts) {
+  int state = regexDFAStart(d, 1);
+  int j;
+
+  starts[n] = (d->flags[state] & (n == 0 ? REGEX_MATCHEND : REGEX_MATCH)) != 0;
+  for (j = n - 1; j >= 0; j--) {
+    state = regexDFAStep(d, state, s[j]);
+    starts[j] = (d->flags[state] & (j == 0 ? REGEX_MATCHEND : REGEX_MATCH)) != 0;
+  }
+}
+
+/*** find ***/
+
+/*
+ * Substring search kernel. Candidate positions are those where both the first and the
+ * last byte of the needle match, found 16 (SSE2) or 32 (AVX2) positions at a time;
+ * only candidates get a memcmp of the bytes in between.
+ */
+
+long editorFindBytesScalar(const char *hay, size_t n, const char *needle, size_t m, size_t i) {
+  for (; i + m <= n; i++) {
+    if (hay[i] == needle[0] && hay[i + m - 1] == needle[m - 1] && memcmp(&hay[i + 1], &needle[1], m - 2) == 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+#ifdef EDITOR_HAVE_SSE2
+long editorFindBytesSSE2(const char *hay, size_t n, const char *needle, size_t m) {
+  __m128i first = _mm_set1_epi8(needle[0]);
+  __m128i last = _mm_set1_epi8(needle[m - 1]);
+  size_t i;
+
+  for (i = 0; i + m - 1 + 16 <= n; i += 16) {
+    __m128i bfirst = _mm_loadu_si128((const __m128i *) &hay[i]);
+    __m128i blast = _mm_loadu_si128((const __m128i *) &hay[i + m - 1]);
+    unsigned mask = _mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first, bfirst), _mm_cmpeq_epi8(last, blast)));
+    while (mask) {
+      int bit = __builtin_ctz(mask);
+      if (memcmp(&hay[i + bit + 1], &needle[1], m - 2) == 0) return i + bit;
+      mask &= mask - 1;
+    }
+  }
+  return editorFindBytesScalar(hay, n, needle, m, i);
+}
+
+__attribute__((target("avx2")))
+long editorFindBytesAVX2(const char *hay, size_t n, const char *needle, size_t m) {
+  __m256i first = _mm256_set1_epi8(needle[0]);
+  __m256i last = _mm256_set1_epi8(needle[m - 1]);
+  size_t i;
+
+  for (i = 0; i + m - 1 + 32 <= n; i += 32) {
+    __m256i bfirst = _mm256_loadu_si256((const __m256i *) &hay[i]);
+    __m256i blast = _mm256_loadu_si256((const __m256i *) &hay[i + m - 1]);
+    unsigned mask = _mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(first, bfirst), _mm256_cmpeq_epi8(last, blast)));
+    while (mask) {
+      int bit = __builtin_ctz(mask);
+      if (memcmp(&hay[i + bit + 1], &needle[1], m - 2) == 0) return i + bit;
+      mask &= mask - 1;
+    }
+  }
+  long at = editorFindBytesSSE2(&hay[i], n - i, needle, m);
+  return at == -1 ? -1 : (long) i + at;
+}
+#endif
+
+/* Offset of the first occurrence of needle in hay, or -1 */
+long editorFindBytes(const char *hay, size_t n, const char *needle, size_t m) {
+  if (m == 0) return 0;
+  if (m > n) return -1;
+  if (m == 1) {
+    const char *p = memchr(hay, needle[0], n);
+    return p ? p - hay : -1;
+  }
+#ifdef EDITOR_HAVE_SSE2
+  static int avx2 = -1;
+  if (avx2 == -1) avx2 = __builtin_cpu_supports("avx2");
+  return avx2 ? editorFindBytesAVX2(hay, n, needle, m) : editorFindBytesSSE2(hay, n, needle, m);
+#else
+  return editorFindBytesScalar(hay, n, needle, m, 0);
+#endif
+}
+
+/* Every thread searching needs its own matcher, re is only read */
+void matcherInit(struct editorMatcher *m, const char *query, struct regex *re) {
+  memset(m, 0, sizeof(*m));
+  m->query = strdup(query);
+  m->len = strlen(query);
+  m->re = re;
+  if (re) {
+    regexDFAInit(&m->fwd, re, 0, 0);
+    regexDFAInit(&m->rev, re, 1, 1);
+  }
+  m->ranges = trigramCandidates(re ? re->literal : query, re ? (size_t) re->literallen : m->len, &m->numranges);
+}
+
+void matcherFree(struct editorMatcher *m) {
+  free(m->query);
+  free(m->starts);
+  free(m->ranges);
+  if (m->re) {
+    regexDFAFree(&m->fwd);
+    regexDFAFree(&m->rev);
+  }
+  memset(m, 0, sizeof(*m));
+}
+
+/* First row from `row` on in the given direction inside one of the row ranges, -1 if there is none */
+int rangesNextRow(const int *ranges, int numranges, int row, int direction) {
+  int lo = 0, hi = numranges;
+  while (lo < hi) { /* first range ending after row */
+    int mid = (lo + hi) / 2;
+    if (ranges[mid * 2 + 1] > row) hi = mid;
+    else lo = mid + 1;
+  }
+  if (direction == 1) {
+    if (lo == numranges) return -1;
+    return ranges[lo * 2] > row ? ranges[lo * 2] : row;
+  }
+  if (lo < numranges && ranges[lo * 2] <= row) return row;
+  return lo > 0 ? ranges[lo * 2 - 1] - 1 : -1;
+}
+
+/* First row from `row` on in the given direction that may hold a match, -1 if there is none */
+int matcherNextRow(struct editorMatcher *m, int row, int direction) {
+  if (m->ranges == NULL || !__atomic_load_n(&ECONFIG.trigram.ready, __ATOMIC_ACQUIRE)) return row;
+  return rangesNextRow(m->ranges, m->numranges, row, direction);
+}
+
+/* Column of the first non-empty match in row at or after col, or -1; its length goes to *len */
+int editorRowFind(struct editorMatcher *m, editorRow *row, int col, int *len) {
+  struct regex *re = m->re;
+  int j;
+  if (col > row->size) return -1;
+
+  if (re == NULL) {
+    long at = editorFindBytes(&row->chars[col], row->size - col, m->query, m->len);
+    *len = m->len;
+    return at == -1 ? -1 : col + at;
+  }
+
+  if (re->literallen > 0 &&
+      editorFindBytes(&row->chars[col], row->size - col, re->literal, re->literallen) == -1) {
+    return -1;
+  }
+  if (m->scanned != row->chars || m->scannedsize != row->size) {
+    if (row->size + 1 > m->startscap) {
+      m->startscap = row->size + 1;
+      m->starts = realloc(m->starts, m->startscap);
+    }
+    regexStarts(&m->rev, row->chars, row->size, m->starts);
+    m->scanned = row->chars;
+    m->scannedsize = row->size;
+  }
+  for (j = col; j <= row->size; j++) {
+    if (!m->starts[j]) continue;
+    int end = regexLongest(&m->fwd, row->chars, row->size, j);
+    if (end > j) {
+      *len = end - j;
+      return j;
+    }
+  }
+  return -1;
+}
+
+/* Column of the last match in row that starts before col, or -1 */
+int editorRowFindLast(struct editorMatcher *m, editorRow *row, int col) {
+  int found = -1, at = 0, len;
+  while ((at = editorRowFind(m, row, at, &len)) != -1 && at < col) {
+    found = at;
+    at++;
+  }
+  return found;
+}
+
+/* Move the cursor to the next match from (row, col) in the given direction, wrapping around */
+int editorFindFrom(int row, int col, int direction, struct editorMatcher *m) {
+  int j, len;
+  if (ECONFIG.numrows == 0) return 0;
+  m->scanned = NULL; /* rows may have changed since the last call */
+
+  for (j = 0; j <= ECONFIG.numrows; j++) {
+    int r = (row + direction * j + ECONFIG.numrows * 2) % ECONFIG.numrows;
+    int at;
+
+    /* skip straight to the next row the index can't rule out, or to the wrap around */
+    int next = matcherNextRow(m, r, direction);
+    int skip = next == -1 ? (direction == 1 ? ECONFIG.numrows - r : r + 1) : (next - r) * direction;
+    if (skip > 0) {
+      j += skip - 1;
+      continue;
+    }
+    if (direction == 1) {
+      at = editorRowFind(m, &ECONFIG.row[r], j == 0 ? col : 0, &len);
+      if (j == ECONFIG.numrows && at >= col) at = -1;
+    }
+    else {
+      at = editorRowFindLast(m, &ECONFIG.row[r], j == 0 ? col : ECONFIG.row[r].size + 1);
+      if (j == ECONFIG.numrows && at < col) at = -1;
+    }
+    if (at != -1) {
+      ECONFIG.cy = ECONFIG.find.row = r;
+      ECONFIG.cx = ECONFIG.find.col = at;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+/*
+ * Render spans of the find matches in row for drawRows(). They are cached in the row and
+ * only searched for again once the row was edited or the query changed.
+ */
+struct rowMatches *editorRowMatches(editorRow *row) {
+  struct editorFind *f = &ECONFIG.find;
+  struct rowMatches *rm = row->matches;
+  if (rm && rm->version == row->version && rm->query == f->query) return rm;
+
+  int cap = 4, at = 0, len, cx = 0, rx = 0;
+  rm = realloc(rm, sizeof(*rm) + sizeof(int) * 2 * cap);
+  rm->version = row->version;
+  rm->query = f->query;
+  rm->count = 0;
+
+  f->matcher.scanned = NULL;
+  while ((at = editorRowFind(&f->matcher, row, at, &len)) != -1) {
+    if (rm->count == cap) {
+      cap *= 2;
+      rm = realloc(rm, sizeof(*rm) + sizeof(int) * 2 * cap);
+    }
+    /* matches come in order, so columns are converted in one pass over the row */
+    int k;
+    for (k = 0; k < 2; k++) {
+      int to = k == 0 ? at : at + len;
+      for (; cx < to; cx++) {
+        rx += editorRenderStep(row->chars[cx], rx);
+      }
+      rm->span[rm->count * 2 + k] = rx;
+    }
+    rm->count++;
+    at += len;
+  }
+  row->matches = rm;
+  return rm;
+}
+
+/*
+ * Find-all runs on a pool of worker threads. Rows are split into chunks of
+ * EDITOR_SEARCH_CHUNK that the workers claim one at a time; matches are handed back
+ * through a mutex-protected pending list that the main loop drains while idle.
+ * Workers only read rows, so editorBeginEdit() stops them before anything changes.
+ */
+
+/* Threads worth starting for the given number of chunks of rows */
+int editorWorkerCount(int chunks) {
+  long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+  int want = cpus < 1 ? 1 : cpus > EDITOR_SEARCH_THREADS ? EDITOR_SEARCH_THREADS : cpus;
+  return want > chunks ? chunks : want;
+}
+
+void *searchWorker(void *arg) {
+  struct editorSearch *s = arg;
+  struct searchMatch local[256];
+  struct editorMatcher m;
+  int nlocal = 0, len;
+
+  matcherInit(&m, s->query, s->re);
+
+  while (!__atomic_load_n(&s->cancel, __ATOMIC_RELAXED)) {
+    int chunk = __atomic_fetch_add(&s->nextchunk, 1, __ATOMIC_RELAXED);
+    int from = chunk * EDITOR_SEARCH_CHUNK;
+    if (from >= s->numrows) break;
+    int to = from + EDITOR_SEARCH_CHUNK < s->numrows ? from + EDITOR_SEARCH_CHUNK : s->numrows;
+
+    int j;
+    for (j = from; j < to && !__atomic_load_n(&s->cancel, __ATOMIC_RELAXED); j++) {
+      if ((j = matcherNextRow(&m, j, 1)) == -1 || j >= to) break;
+      int at = 0;
+      while ((at = editorRowFind(&m, &ECONFIG.row[j], at, &len)) != -1) {
+        local[nlocal].row = j;
+        local[nlocal].col = at;
+        local[nlocal].len = len;
+        at += len;
+        if (++nlocal == (int) (sizeof(local) / sizeof(local[0]))) {
+          searchPublish(s, local, nlocal);
+          nlocal = 0;
+        }
+      }
+    }
+    if (nlocal > 0) {
+      searchPublish(s, local, nlocal);
+      nlocal = 0;
+    }
+  }
+
+  matcherFree(&m);
+  __atomic_fetch_sub(&s->running, 1, __ATOMIC_RELEASE);
+  return NULL;
+}
+
+void searchPublish(struct editorSearch *s, struct searchMatch *m, int n) {
+  pthread_mutex_lock(&s->lock);
+  if (s->npending + n > s->pendingcap) {
+    s->pendingcap = (s->npending + n) * 2;
+    s->pending = realloc(s->pending, sizeof(*m) * s->pendingcap);
+  }
+  memcpy(&s->pending[s->npending], m, sizeof(*m) * n);
+  s->npending += n;
+  pthread_mutex_unlock(&s->lock);
+}
+
+/* Cancel and join the workers, matches found so far are kept */
+void searchStop() {
+  struct editorSearch *s = &ECONFIG.search;
+  int j;
+  if (s->nthreads == 0) return;
+
+  __atomic_store_n(&s->cancel, 1, __ATOMIC_RELAXED);
+  for (j = 0; j < s->nthreads; j++) pthread_join(s->thread[j], NULL);
+  s->nthreads = 0;
+  s->npending = 0;
+}
+
+/* Forget the search entirely, e.g. because the rows it refers to changed */
+void searchClear() {
+  struct editorSearch *s = &ECONFIG.search;
+  searchStop();
+  free(s->query);
+  regexFree(s->re);
+  s->query = NULL;
+  s->re = NULL;
+  s->nmatches = 0;
+}
+
+void searchStart(const char *query, int regex) {
+  struct editorSearch *s = &ECONFIG.search;
+  const char *error;
+  searchClear();
+  if (query[0] == '\0' || ECONFIG.numrows == 0) return;
+  if (regex && (s->re = regexCompile(query, &error)) == NULL) return;
+
+  s->query = strdup(query);
+  s->numrows = ECONFIG.numrows;
+  s->nextchunk = 0;
+  s->cancel = 0;
+  s->done = 0;
+
+  int want = editorWorkerCount((s->numrows + EDITOR_SEARCH_CHUNK - 1) / EDITOR_SEARCH_CHUNK);
+
+  s->running = want;
+  while (s->nthreads < want) {
+    if (pthread_create(&s->thread[s->nthreads], NULL, searchWorker, s) != 0) {
+      __atomic_fetch_sub(&s->running, want - s->nthreads, __ATOMIC_RELEASE);
+      break;
+    }
+    s->nthreads++;
+  }
+  if (s->nthreads == 0) s->done = 1;
+}
+
+/* Collect matches streamed in by the workers, returns 1 if there is something new to show */
+int searchPoll() {
+  struct editorSearch *s = &ECONFIG.search;
+  if (s->nthreads == 0) return 0;
+
+  int finished = __atomic_load_n(&s->running, __ATOMIC_ACQUIRE) == 0;
+  pthread_mutex_lock(&s->lock);
+  size_t n = s->npending;
+  if (n > 0) {
+    if (s->nmatches + n > s->cap) {
+      s->cap = (s->nmatches + n) * 2;
+      s->matches = realloc(s->matches, sizeof(struct searchMatch) * s->cap);
+    }
+    memcpy(&s->matches[s->nmatches], s->pending, sizeof(struct searchMatch) * n);
+    s->nmatches += n;
+    s->npending = 0;
+  }
+  pthread_mutex_unlock(&s->lock);
+
+  if (finished) {
+    searchStop();
+    s->done = 1;
+    return 1;
+  }
+  return n > 0;
+}
+
+void editorFindPrompt(const char *error) {
+  struct editorFind *f = &ECONFIG.find;
+  snprintf(f->prompt, sizeof(f->prompt), "%s: %%s (%s)", f->regex ? "Regex" : "Search",
+    error ? error : "ESC to cancel, arrows for next/previous, Ctrl-R regex");
+}
+
+void editorFindCallback(char *query, int key) {
+  struct editorFind *f = &ECONFIG.find;
+  const char *error = NULL;
+
+  if (key == '\r' || key == '\x1b') {
+    f->active = 0;
+    if (key == '\x1b') {
+      searchClear();
+      f->highlight = 0;
+    }
+    return;
+  }
+  if (key == CTRL_KEY('r')) {
+    f->regex = !f->regex;
+    editorFindPrompt(NULL);
+  }
+
+  if (query[0] == '\0') {
+    ECONFIG.cy = f->orig_cy;
+    ECONFIG.cx = f->orig_cx;
+    f->row = -1;
+    f->highlight = 0;
+    searchClear();
+    return;
+  }
+
+  if ((key == ARROW_RIGHT || key == ARROW_DOWN) && f->row != -1) {
+    editorFindFrom(f->row, f->col + 1, 1, &f->matcher);
+  }
+  else if ((key == ARROW_LEFT || key == ARROW_UP) && f->row != -1) {
+    editorFindFrom(f->row, f->col, -1, &f->matcher);
+  }
+  else if (key == CTRL_KEY('r') || f->matcher.query == NULL || strcmp(f->matcher.query, query) != 0) {
+    searchClear();
+    matcherFree(&f->matcher);
+    regexFree(f->re);
+    f->re = f->regex ? regexCompile(query, &error) : NULL;
+    matcherInit(&f->matcher, query, f->re);
+    f->query++;
+    f->highlight = error == NULL;
+    editorFindPrompt(error);
+    if (error == NULL) searchStart(query, f->regex);
+    if (error || !editorFindFrom(f->orig_cy, f->orig_cx, 1, &f->matcher)) {
+      /* the query grew past anything in the buffer, stay where we started */
+      ECONFIG.cy = f->orig_cy;
+      ECONFIG.cx = f->orig_cx;
+      f->row = -1;
+    }
+  }
+}
+
+/* Incremental search: the cursor jumps to the first match as the query is typed */
+void editorFind() {
+  struct editorFind *f = &ECONFIG.find;
+  f->orig_cy = ECONFIG.cy;
+  f->orig_cx = ECONFIG.cx;
+  f->orig_rowoffset = ECONFIG.rowoffset;
+  f->orig_coloffset = ECONFIG.coloffset;
+  f->row = -1;
+  f->active = 1;
+  f->highlight = 0;
+  matcherFree(&f->matcher);
+  editorFindPrompt(NULL);
+
+  char *query = editorPrompt(f->prompt, editorFindCallback);
+  if (query) {
+    free(query);
+  }
+  else {
+    ECONFIG.cy = f->orig_cy;
+    ECONFIG.cx = f->orig_cx;
+    ECONFIG.rowoffset = f->orig_rowoffset;
+    ECONFIG.coloffset = f->orig_coloffset;
+  }
+}
+
+/*** trigram index ***/
+
+/*
+ * Big files get an index for repeated searches. Rows are grouped into blocks of at least
+ * EDITOR_TRIGRAM_BLOCK bytes and every trigram in a block sets one hashed bit in the
+ * block's filter, so a block can only hold a literal if the bits of all its trigrams are
+ * set. A thread builds the index after editorOpen and stores it next to the file as
+ * .<name>.ftrigram, keyed by the file identity, so later sessions just map it in.
+ * The index describes the file as loaded: the first edit throws it away.
+ */
+
+uint32_t trigramBit(const unsigned char *p) {
+  uint32_t t = p[0] | (p[1] << 8) | ((uint32_t) p[2] << 16);
+  return (t * 2654435761u) >> (32 - EDITOR_TRIGRAM_BITS);
+}
+
+void trigramSave(struct editorTrigram *t) {
+  struct trigramHeader hdr;
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.magic, TRIGRAM_MAGIC, sizeof(hdr.magic));
+  hdr.version = TRIGRAM_VERSION;
+  hdr.file = t->file;
+  hdr.numrows = t->blockrow[t->numblocks];
+  hdr.numblocks = t->numblocks;
+  hdr.bits = EDITOR_TRIGRAM_BITS;
+
+  size_t rowslen = sizeof(int32_t) * (t->numblocks + 1);
+  size_t bitslen = (size_t) t->numblocks * TRIGRAM_FILTER_BYTES;
+  char *tmp = malloc(strlen(t->path) + 5);
+  sprintf(tmp, "%s.tmp", t->path);
+  int fd = open(tmp, O_WRONLY | O_CREAT | O_TRUNC, 0600);
+  if (fd != -1) {
+    if (editorWriteAt(fd, (char *) &hdr, sizeof(hdr), 0) == 0 &&
+        editorWriteAt(fd, (char *) t->blockrow, rowslen, sizeof(hdr)) == 0 &&
+        editorWriteAt(fd, (char *) t->bits, bitslen, sizeof(hdr) + rowslen) == 0 && close(fd) == 0) {
+      rename(tmp, t->path);
+    }
+    else {
+      close(fd);
+      unlink(tmp);
+    }
+  }
+  free(tmp);
+}
+
+void *trigramBuild(void *arg) {
+  struct editorTrigram *t = arg;
+  int maxblocks = ECONFIG.disk_size / EDITOR_TRIGRAM_BLOCK + 1;
+  int j = 0, b;
+
+  t->blockrow = malloc(sizeof(int32_t) * (maxblocks + 1));
+  t->bits = calloc(maxblocks, TRIGRAM_FILTER_BYTES);
+  for (b = 0; j < ECONFIG.numrows && b < maxblocks; b++) {
+    unsigned char *filter = &t->bits[(size_t) b * TRIGRAM_FILTER_BYTES];
+    size_t bytes = 0;
+    if (__atomic_load_n(&t->cancel, __ATOMIC_RELAXED)) return NULL;
+
+    t->blockrow[b] = j;
+    for (; j < ECONFIG.numrows && (bytes < EDITOR_TRIGRAM_BLOCK || b == maxblocks - 1); j++) {
+      const unsigned char *p = (const unsigned char *) ECONFIG.row[j].chars;
+      int k;
+      for (k = 0; k + 2 < ECONFIG.row[j].size; k++) {
+        uint32_t bit = trigramBit(&p[k]);
+        filter[bit >> 3] |= 1 << (bit & 7);
+      }
+      bytes += ECONFIG.row[j].size + 1;
+    }
+  }
+  t->numblocks = b;
+  t->blockrow[b] = j;
+
+  trigramSave(t);
+  __atomic_store_n(&t->ready, 1, __ATOMIC_RELEASE);
+  return NULL;
+}
+
+/* Map in a saved index, if it was built from this very file */
+int trigramLoad(struct editorTrigram *t) {
+  int fd = open(t->path, O_RDONLY);
+  if (fd == -1) return 0;
+  struct stat st;
+  struct trigramHeader *hdr = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && (size_t) st.st_size >= sizeof(*hdr)) {
+    hdr = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (hdr == MAP_FAILED) return 0;
+
+  size_t want = sizeof(*hdr) + sizeof(int32_t) * ((size_t) hdr->numblocks + 1) +
+    (size_t) hdr->numblocks * TRIGRAM_FILTER_BYTES;
+  if (memcmp(hdr->magic, TRIGRAM_MAGIC, sizeof(hdr->magic)) != 0 || hdr->version != TRIGRAM_VERSION ||
+      memcmp(&hdr->file, &t->file, sizeof(t->file)) != 0 || hdr->bits != EDITOR_TRIGRAM_BITS ||
+      (int) hdr->numrows != ECONFIG.numrows || (size_t) st.st_size != want) {
+    munmap(hdr, st.st_size);
+    return 0;
+  }
+
+  t->map = hdr;
+  t->maplen = st.st_size;
+  t->numblocks = hdr->numblocks;
+  t->blockrow = (int32_t *) (hdr + 1);
+  t->bits = (unsigned char *) (t->blockrow + hdr->numblocks + 1);
+  t->ready = 1;
+  return 1;
+}
+
+/* Called once the file is loaded: use the saved index or build one in the background */
+void trigramOpen(const char *filename, struct stat *st) {
+  struct editorTrigram *t = &ECONFIG.trigram;
+  char *min = getenv("FLY_TRIGRAM_MIN");
+  if (st->st_size < (min ? atoll(min) : EDITOR_TRIGRAM_MIN_SIZE) || ECONFIG.dirty) return;
+
+  t->path = editorSidecarPath(filename, "ftrigram");
+  fileIdentityFromStat(&t->file, st);
+  if (trigramLoad(t)) return;
+
+  t->cancel = 0;
+  if (pthread_create(&t->thread, NULL, trigramBuild, t) == 0) t->running = 1;
+}
+
+/* Drop the index, called before the rows it describes change */
+void trigramDiscard() {
+  struct editorTrigram *t = &ECONFIG.trigram;
+  if (t->running) {
+    __atomic_store_n(&t->cancel, 1, __ATOMIC_RELAXED);
+    pthread_join(t->thread, NULL);
+    t->running = 0;
+  }
+  if (t->map) {
+    munmap(t->map, t->maplen);
+  }
+  else {
+    free(t->blockrow);
+    free(t->bits);
+  }
+  free(t->path);
+  memset(t, 0, sizeof(*t));
+}
+
+/*
+ * Drop the index while the rows stay as they are, as on save. A find-all still running
+ * may be reading it, so that one is stopped first and started over without it.
+ */
+void trigramDrop() {
+  struct editorSearch *s = &ECONFIG.search;
+  char *query = s->nthreads > 0 ? strdup(s->query) : NULL;
+  int regex = s->re != NULL;
+  if (query) searchClear();
+  trigramDiscard();
+  if (query) {
+    searchStart(query, regex);
+    free(query);
+  }
+}
+
+/* Row ranges of the blocks that may contain s, NULL when the index can't tell */
+int *trigramCandidates(const char *s, size_t len, int *numranges) {
+  struct editorTrigram *t = &ECONFIG.trigram;
+  if (len < 3 || !__atomic_load_n(&t->ready, __ATOMIC_ACQUIRE)) return NULL;
+
+  int n = len - 2 < EDITOR_TRIGRAM_PROBES ? len - 2 : EDITOR_TRIGRAM_PROBES;
+  uint32_t bit[EDITOR_TRIGRAM_PROBES];
+  int *ranges = NULL, cap = 0, j, b;
+  *numranges = 0;
+  for (j = 0; j < n; j++) bit[j] = trigramBit((const unsigned char *) &s[j * (len - 3) / (n > 1 ? n - 1 : 1)]);
+
+  for (b = 0; b < t->numblocks; b++) {
+    const unsigned char *filter = &t->bits[(size_t) b * TRIGRAM_FILTER_BYTES];
+    for (j = 0; j < n && (filter[bit[j] >> 3] & (1 << (bit[j] & 7))); j++);
+    if (j < n) continue;
+
+    if (*numranges > 0 && ranges[*numranges * 2 - 1] == t->blockrow[b]) {
+      ranges[*numranges * 2 - 1] = t->blockrow[b + 1];
+      continue;
+    }
+    if (*numranges == cap) {
+      cap = cap ? cap * 2 : 16;
+      ranges = realloc(ranges, sizeof(int) * 2 * cap);
+    }
+    ranges[*numranges * 2] = t->blockrow[b];
+    ranges[*numranges * 2 + 1] = t->blockrow[b + 1];
+    (*numranges)++;
+  }
+  if (ranges == NULL) ranges = malloc(sizeof(int) * 2); /* nothing can match */
+  return ranges;
+}
+
+/*** replace ***/
+
+/*
+ * Replace-all. Worker threads claim chunks of rows like find-all does and rebuild every
+ * row with a match, chars and render, into chunk-local results without touching the
+ * buffer. The main thread then swaps the new rows in, in order, logging for each row a
+ * delete and an insert of the span between its first and last match to the journal and
+ * to one undo group.
+ */
+
+struct replaceRow {
+  int row;
+  int from, oldto, newto; /* span that changed, in old and new columns */
+  editorRow text; /* rebuilt chars and render */
+};
+
+struct replaceChunk {
+  struct replaceRow *rows;
+  int numrows, cap;
+  long long count; /* replacements */
+};
+
+struct editorReplace {
+  const char *query;
+  struct regex *re;
+  const char *with;
+  size_t withlen;
+  int *ranges, numranges; /* rows that may match, asked of the trigram index before the edit drops it */
+  struct replaceChunk *chunks;
+  int numchunks, nextchunk;
+};
+
+void replaceAppend(char **buf, size_t *len, size_t *cap, const char *s, size_t n) {
+  if (*len + n + 1 > *cap) {
+    *cap = (*len + n + 1) * 2;
+    *buf = realloc(*buf, *cap);
+  }
+  memcpy(*buf + *len, s, n);
+  *len += n;
+}
+
+void replaceBuildRow(struct editorReplace *rp, struct editorMatcher *m, struct replaceChunk *c, int j) {
+  editorRow *row = &ECONFIG.row[j];
+  char *buf = NULL;
+  size_t used = 0, cap = 0;
+  int at = 0, prev = 0, first = -1, len;
+
+  while ((at = editorRowFind(m, row, at, &len)) != -1) {
+    if (first == -1) {
+      first = at;
+      cap = row->size + rp->withlen * 2 + 1;
+      buf = malloc(cap);
+    }
+    replaceAppend(&buf, &used, &cap, &row->chars[prev], at - prev);
+    replaceAppend(&buf, &used, &cap, rp->with, rp->withlen);
+    prev = at = at + len;
+    c->count++;
+  }
+  if (first == -1) return;
+  replaceAppend(&buf, &used, &cap, &row->chars[prev], row->size - prev);
+  buf[used] = '\0';
+
+  if (c->numrows == c->cap) {
+    c->cap = c->cap ? c->cap * 2 : 64;
+    c->rows = realloc(c->rows, sizeof(struct replaceRow) * c->cap);
+  }
+  struct replaceRow *r = &c->rows[c->numrows++];
+  r->row = j;
+  r->from = first;
+  r->oldto = prev;
+  r->newto = used - (row->size - prev);
+  memset(&r->text, 0, sizeof(r->text));
+  r->text.chars = buf;
+  r->text.size = used;
+  editorUpdateRow(&r->text);
+}
+
+void *replaceWorker(void *arg) {
+  struct editorReplace *rp = arg;
+  struct editorMatcher m;
+  matcherInit(&m, rp->query, rp->re);
+
+  while (1) {
+    int chunk = __atomic_fetch_add(&rp->nextchunk, 1, __ATOMIC_RELAXED);
+    if (chunk >= rp->numchunks) break;
+    int from = chunk * EDITOR_SEARCH_CHUNK, j;
+    int to = from + EDITOR_SEARCH_CHUNK < ECONFIG.numrows ? from + EDITOR_SEARCH_CHUNK : ECONFIG.numrows;
+    for (j = from; j < to; j++) {
+      if (rp->ranges && (j = rangesNextRow(rp->ranges, rp->numranges, j, 1)) == -1) break;
+      if (j >= to) break;
+      replaceBuildRow(rp, &m, &rp->chunks[chunk], j);
+    }
+  }
+  matcherFree(&m);
+  return NULL;
+}
+
+/* Replace every match of query with `with` as one edit, returns the number of replacements or -1 */
+long long editorReplaceAll(const char *query, int regex, const char *with) {
+  struct editorReplace rp;
+  const char *error;
+  pthread_t thread[EDITOR_SEARCH_THREADS];
+  int nthreads = 0, j, k;
+  long long count = 0;
+
+  memset(&rp, 0, sizeof(rp));
+  rp.query = query;
+  rp.with = with;
+  rp.withlen = strlen(with);
+  if (regex && (rp.re = regexCompile(query, &error)) == NULL) {
+    editorSetStatusMessage("Bad regex: %s", error);
+    return -1;
+  }
+  rp.ranges = trigramCandidates(rp.re ? rp.re->literal : query, rp.re ? (size_t) rp.re->literallen : strlen(query),
+    &rp.numranges);
+  editorBeginEdit();
+
+  /* the main thread builds rows too, alongside the workers */
+  rp.numchunks = (ECONFIG.numrows + EDITOR_SEARCH_CHUNK - 1) / EDITOR_SEARCH_CHUNK;
+  rp.chunks = calloc(rp.numchunks + 1, sizeof(struct replaceChunk));
+  int want = editorWorkerCount(rp.numchunks) - 1;
+  while (nthreads < want && pthread_create(&thread[nthreads], NULL, replaceWorker, &rp) == 0) nthreads++;
+  replaceWorker(&rp);
+  for (j = 0; j < nthreads; j++) pthread_join(thread[j], NULL);
+
+  undoBreak();
+  ECONFIG.undo.bulk = 1;
+  for (j = 0; j < rp.numchunks; j++) {
+    struct replaceChunk *c = &rp.chunks[j];
+    for (k = 0; k < c->numrows; k++) {
+      struct replaceRow *r = &c->rows[k];
+      editorRow *row = &ECONFIG.row[r->row];
+      undoRecord(UNDO_DELETE, r->row, r->from, &row->chars[r->from], r->oldto - r->from);
+      undoRecord(UNDO_INSERT, r->row, r->from, &r->text.chars[r->from], r->newto - r->from);
+      journalRecordText(JOURNAL_DELETE_TEXT, r->row, r->from, NULL, r->oldto - r->from);
+      journalRecordText(JOURNAL_INSERT_TEXT, r->row, r->from, &r->text.chars[r->from], r->newto - r->from);
+
+      editorFreeRow(row);
+      row->chars = r->text.chars;
+      row->size = r->text.size;
+      row->render = r->text.render;
+      row->rsize = r->text.rsize;
+      row->ascii = r->text.ascii;
+      row->hl = NULL;
+      row->hl_version = ~0u;
+      row->hl_in = row->hl_out = 0;
+      row->hlslot = NULL;
+      row->matches = NULL;
+      row->colmarks = NULL;
+      editorRowModified(row);
+      if (ECONFIG.rowindex.built) rowIndexUpdate(r->row);
+      ECONFIG.dirty++;
+    }
+    count += c->count;
+    free(c->rows);
+  }
+  ECONFIG.undo.bulk = 0;
+  undoBreak();
+
+  free(rp.chunks);
+  free(rp.ranges);
+  regexFree(rp.re);
+  editorClampCursor();
+  return count;
+}
+
+void editorReplacePrompt() {
+  struct editorFind *f = &ECONFIG.find;
+  snprintf(f->prompt, sizeof(f->prompt), "Replace %s: %%s (ESC to cancel, Ctrl-R regex)",
+    f->regex ? "regex" : "text");
+}
+
+void editorReplaceCallback(char *query, int key) {
+  (void) query;
+  if (key == CTRL_KEY('r')) {
+    ECONFIG.find.regex = !ECONFIG.find.regex;
+    editorReplacePrompt();
+  }
+}
+
+void editorReplace() {
+  editorReplacePrompt();
+  char *query = editorPrompt(ECONFIG.find.prompt, editorReplaceCallback);
+  if (query == NULL) return;
+  char *with = editorPrompt("Replace with: %s (ESC to cancel)", NULL);
+  if (with) {
+    int before = ECONFIG.dirty;
+    long long count = editorReplaceAll(query, ECONFIG.find.regex, with);
+    if (count >= 0) {
+      editorSetStatusMessage("Replaced %lld matches in %d rows", count, ECONFIG.dirty - before);
+    }
+    free(with);
+  }
+  free(query);
+}
+
+/*** row index ***/
+
+/*
+ * Per-row summaries kept in a treap ordered by row number, so rows can be inserted and
+ * deleted in O(log n) and every subtree knows its row count, the sum of its bracket
+ * deltas and the lowest nesting depth and indentation inside it. With those the depth
+ * at any row is a prefix sum, and the next row where the nesting drops below some depth,
+ * or the indentation to some level, is found by one walk down the tree instead of a scan.
+ * The tree is built on first use and from then on kept up to date by the row operations.
+ *
+ * Brackets are ( [ { and their closers, all kinds counted alike; text between double
+ * quotes on the same row is skipped. Fold state lives in the same tree, see below.
+ */
+
+/* Bracket delta of s[j], tracking double quoted strings in *quote */
+int editorBracketStep(const char *s, int j, int *quote) {
+  char c = s[j];
+  if (*quote) {
+    if (*quote == 2) *quote = 1; /* escaped */
+    else if (c == '\\') *quote = 2;
+    else if (c == '"') *quote = 0;
+    return 0;
+  }
+  switch (c) {
+    case '"': *quote = 1; return 0;
+    case '(': case '[': case '{': return 1;
+    case ')': case ']': case '}': return -1;
+  }
+  return 0;
+}
+
+int rowIndexNew() {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  int t;
+  if (x->freelist) {
+    t = x->freelist;
+    x->freelist = x->nodes[t].left;
+  }
+  else {
+    if (x->numnodes == x->cap) {
+      x->cap = x->cap ? x->cap * 2 : 1024;
+      x->nodes = realloc(x->nodes, sizeof(struct rowNode) * x->cap);
+    }
+    t = x->numnodes++;
+  }
+  x->seed ^= x->seed << 13;
+  x->seed ^= x->seed >> 17;
+  x->seed ^= x->seed << 5;
+  struct rowNode *n = &x->nodes[t];
+  memset(n, 0, sizeof(*n));
+  n->prio = x->seed;
+  n->size = 1;
+  n->lines = 1;
+  n->indent = n->minindent = INT_MAX;
+  return t;
+}
+
+/* Summarize row into node t */
+void rowIndexSet(int t, editorRow *row) {
+  struct rowNode *n = &ECONFIG.rowindex.nodes[t];
+  int depth = 0, quote = 0, j;
+  n->dip = 0;
+  for (j = 0; j < row->size; j++) {
+    depth += editorBracketStep(row->chars, j, &quote);
+    if (depth < n->dip) n->dip = depth;
+  }
+  n->delta = depth;
+  for (j = 0; j < row->rsize && row->render[j] == ' '; j++);
+  n->indent = j < row->rsize ? j : INT_MAX;
+  n->lines = ECONFIG.wrap ? editorWrapCount(row) : 1;
+}
+
+/* Add v to the cover of every row in subtree t */
+void rowIndexApply(int t, int v) {
+  struct rowNode *n = &ECONFIG.rowindex.nodes[t];
+  if (t == 0) return;
+  n->cover += v;
+  n->mincover += v;
+  n->tag += v;
+}
+
+void rowIndexPush(int t) {
+  struct rowNode *n = &ECONFIG.rowindex.nodes[t];
+  if (n->tag) {
+    rowIndexApply(n->left, n->tag);
+    rowIndexApply(n->right, n->tag);
+    n->tag = 0;
+  }
+}
+
+void rowIndexPull(int t) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  struct rowNode *n = &nodes[t], *l = &nodes[n->left], *r = &nodes[n->right];
+  int child[2] = {n->left, n->right}, k;
+  n->size = l->size + 1 + r->size;
+  n->sumdelta = l->sumdelta + n->delta + r->sumdelta;
+  n->mindip = l->mindip;
+  if (l->sumdelta + n->dip < n->mindip) n->mindip = l->sumdelta + n->dip;
+  if (l->sumdelta + n->delta + r->mindip < n->mindip) n->mindip = l->sumdelta + n->delta + r->mindip;
+  n->minindent = n->indent;
+  if (l->minindent < n->minindent) n->minindent = l->minindent;
+  if (r->minindent < n->minindent) n->minindent = r->minindent;
+  n->heads = l->heads + (n->foldlen > 0) + r->heads;
+
+  /* the children do not have this node's tag yet */
+  n->mincover = n->cover;
+  n->minlines = n->lines;
+  for (k = 0; k < 2; k++) {
+    if (child[k] == 0) continue;
+    int m = nodes[child[k]].mincover + n->tag;
+    if (m < n->mincover) {
+      n->mincover = m;
+      n->minlines = nodes[child[k]].minlines;
+    }
+    else if (m == n->mincover) {
+      n->minlines += nodes[child[k]].minlines;
+    }
+  }
+}
+
+/* Split t into its first k rows and the rest */
+void rowIndexSplit(int t, int k, int *a, int *b) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  if (t == 0) {
+    *a = *b = 0;
+    return;
+  }
+  rowIndexPush(t);
+  if (nodes[nodes[t].left].size >= k) {
+    rowIndexSplit(nodes[t].left, k, a, &nodes[t].left);
+    *b = t;
+  }
+  else {
+    rowIndexSplit(nodes[t].right, k - nodes[nodes[t].left].size - 1, &nodes[t].right, b);
+    *a = t;
+  }
+  rowIndexPull(t);
+}
+
+int rowIndexMerge(int a, int b) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  if (a == 0 || b == 0) return a ? a : b;
+  if (nodes[a].prio > nodes[b].prio) {
+    rowIndexPush(a);
+    nodes[a].right = rowIndexMerge(nodes[a].right, b);
+    rowIndexPull(a);
+    return a;
+  }
+  rowIndexPush(b);
+  nodes[b].left = rowIndexMerge(a, nodes[b].left);
+  rowIndexPull(b);
+  return b;
+}
+
+void rowIndexPullAll(int t) {
+  if (t == 0) return;
+  rowIndexPullAll(ECONFIG.rowindex.nodes[t].left);
+  rowIndexPullAll(ECONFIG.rowindex.nodes[t].right);
+  rowIndexPull(t);
+}
+
+/* Treap of rows [at, at + n) in O(n): the rightmost path is kept on a stack as nodes come in */
+int rowIndexBuildRange(int at, int n) {
+  int *stack = malloc(sizeof(int) * (n + 1));
+  int sp = 0, j;
+  for (j = 0; j < n; j++) {
+    int t = rowIndexNew(), last = 0;
+    struct rowNode *nodes = ECONFIG.rowindex.nodes;
+    rowIndexSet(t, &ECONFIG.row[at + j]);
+    while (sp > 0 && nodes[stack[sp - 1]].prio < nodes[t].prio) last = stack[--sp];
+    nodes[t].left = last;
+    if (sp > 0) nodes[stack[sp - 1]].right = t;
+    stack[sp++] = t;
+  }
+  int root = sp > 0 ? stack[0] : 0;
+  free(stack);
+  rowIndexPullAll(root);
+  return root;
+}
+
+void rowIndexBuild() {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  if (x->built) return;
+  if (x->numnodes == 0) {
+    x->seed = 2463534242u;
+    rowIndexNew(); /* the empty tree */
+    x->nodes[0].size = 0;
+  }
+  x->root = rowIndexBuildRange(0, ECONFIG.numrows);
+  x->built = 1;
+}
+
+void rowIndexDiscard() {
+  free(ECONFIG.rowindex.nodes);
+  memset(&ECONFIG.rowindex, 0, sizeof(ECONFIG.rowindex));
+}
+
+void rowIndexInsert(int at, int n) {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  int a, b;
+  rowIndexOpenFolds(at, 0);
+  int mid = rowIndexBuildRange(at, n);
+  rowIndexSplit(x->root, at, &a, &b);
+  x->root = rowIndexMerge(rowIndexMerge(a, mid), b);
+}
+
+void rowIndexFree(int t) {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  if (t == 0) return;
+  rowIndexFree(x->nodes[t].left);
+  rowIndexFree(x->nodes[t].right);
+  x->nodes[t].left = x->freelist;
+  x->freelist = t;
+}
+
+void rowIndexDelete(int at, int n) {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  int a, b, c;
+  rowIndexOpenFolds(at, n);
+  rowIndexSplit(x->root, at, &a, &b);
+  rowIndexSplit(b, n, &b, &c);
+  rowIndexFree(b);
+  x->root = rowIndexMerge(a, c);
+}
+
+void rowIndexUpdateNode(int t, int k, editorRow *row) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  int left = nodes[nodes[t].left].size;
+  if (k < left) rowIndexUpdateNode(nodes[t].left, k, row);
+  else if (k > left) rowIndexUpdateNode(nodes[t].right, k - left - 1, row);
+  else rowIndexSet(t, row);
+  rowIndexPull(t);
+}
+
+/* Row `at` changed, refresh its summary and those of the subtrees above it */
+void rowIndexUpdate(int at) {
+  rowIndexUpdateNode(ECONFIG.rowindex.root, at, &ECONFIG.row[at]);
+}
+
+/* Node of row at */
+int rowIndexNode(int at) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  int t = ECONFIG.rowindex.root;
+  while (t) {
+    int left = nodes[nodes[t].left].size;
+    if (at == left) break;
+    if (at < left) {
+      t = nodes[t].left;
+    }
+    else {
+      at -= left + 1;
+      t = nodes[t].right;
+    }
+  }
+  return t;
+}
+
+/* Nesting depth at the start of row at */
+int rowIndexDepth(int at) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  int t = ECONFIG.rowindex.root, depth = 0;
+  while (t) {
+    int left = nodes[nodes[t].left].size;
+    if (at <= left) {
+      t = nodes[t].left;
+    }
+    else {
+      depth += nodes[nodes[t].left].sumdelta + nodes[t].delta;
+      at -= left + 1;
+      t = nodes[t].right;
+    }
+  }
+  return depth;
+}
+
+/* First row >= from in subtree t, which starts at row base and depth, where the nesting drops below d */
+int rowIndexFirstBelow(int t, int base, int depth, int from, int d) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  if (t == 0 || base + nodes[t].size <= from || depth + nodes[t].mindip >= d) return -1;
+  int r = rowIndexFirstBelow(nodes[t].left, base, depth, from, d);
+  if (r != -1) return r;
+  int at = base + nodes[nodes[t].left].size;
+  depth += nodes[nodes[t].left].sumdelta;
+  if (at >= from && depth + nodes[t].dip < d) return at;
+  return rowIndexFirstBelow(nodes[t].right, at + 1, depth + nodes[t].delta, from, d);
+}
+
+/* Last row <= to in subtree t where the nesting drops below d */
+int rowIndexLastBelow(int t, int base, int depth, int to, int d) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  if (t == 0 || base > to || depth + nodes[t].mindip >= d) return -1;
+  int at = base + nodes[nodes[t].left].size;
+  int mid = depth + nodes[nodes[t].left].sumdelta;
+  int r = rowIndexLastBelow(nodes[t].right, at + 1, mid + nodes[t].delta, to, d);
+  if (r != -1) return r;
+  if (at <= to && mid + nodes[t].dip < d) return at;
+  return rowIndexLastBelow(nodes[t].left, base, depth, to, d);
+}
+
+/* First row >= from in subtree t indented by at most indent columns */
+int rowIndexFirstIndent(int t, int base, int from, int indent) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  if (t == 0 || base + nodes[t].size <= from || nodes[t].minindent > indent) return -1;
+  int r = rowIndexFirstIndent(nodes[t].left, base, from, indent);
+  if (r != -1) return r;
+  int at = base + nodes[nodes[t].left].size;
+  if (at >= from && nodes[t].indent <= indent) return at;
+  return rowIndexFirstIndent(nodes[t].right, at + 1, from, indent);
+}
+
+/*
+ * Fold that starts at row at: down to the row that closes the brackets it leaves open,
+ * or else over the rows below it that are indented deeper. Returns the last row of the
+ * fold, or -1 when nothing folds there.
+ */
+int editorFoldEnd(int at) {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  if (at < 0 || at >= ECONFIG.numrows) return -1;
+  rowIndexBuild();
+
+  int depth = rowIndexDepth(at + 1);
+  if (depth > rowIndexDepth(at)) {
+    int end = rowIndexFirstBelow(x->root, 0, 0, at + 1, depth);
+    return end == -1 ? ECONFIG.numrows - 1 : end;
+  }
+
+  int indent = x->nodes[rowIndexNode(at)].indent;
+  if (indent == INT_MAX) return -1;
+  int end = rowIndexFirstIndent(x->root, 0, at + 1, indent);
+  if (end == -1) end = ECONFIG.numrows;
+  while (end - 1 > at && x->nodes[rowIndexNode(end - 1)].indent == INT_MAX) end--; /* not the blank rows after it */
+  return end - 1 > at ? end - 1 : -1;
+}
+
+/* Jump from the bracket under the cursor to the one that matches it */
+void editorMatchBracket() {
+  if (ECONFIG.cy >= ECONFIG.numrows) return;
+  editorRow *row = &ECONFIG.row[ECONFIG.cy];
+  int quote = 0, delta = 0, depth, j;
+  rowIndexBuild();
+
+  depth = rowIndexDepth(ECONFIG.cy);
+  for (j = 0; j <= ECONFIG.cx && j < row->size; j++) {
+    delta = editorBracketStep(row->chars, j, &quote);
+    if (j < ECONFIG.cx) depth += delta;
+  }
+  if (ECONFIG.cx >= row->size || delta == 0) {
+    editorSetStatusMessage("No bracket under the cursor");
+    return;
+  }
+
+  int target = -1, col = -1;
+  if (delta > 0) {
+    /* the first place after it where the depth falls back below the bracket's */
+    int d = depth + 1, cur = d, at = ECONFIG.cy, from = ECONFIG.cx + 1;
+    while (at != -1) {
+      editorRow *r = &ECONFIG.row[at];
+      for (j = from; j < r->size; j++) {
+        cur += editorBracketStep(r->chars, j, &quote);
+        if (cur < d) break;
+      }
+      if (j < r->size) {
+        target = at;
+        col = j;
+        break;
+      }
+      at = rowIndexFirstBelow(ECONFIG.rowindex.root, 0, 0, at + 1, d);
+      if (at != -1) cur = rowIndexDepth(at);
+      from = 0;
+      quote = 0;
+    }
+  }
+  else {
+    /* the last place before it that is below the bracket's depth is right before its opener */
+    int d = depth, at = ECONFIG.cy, to = ECONFIG.cx;
+    while (at != -1) {
+      editorRow *r = &ECONFIG.row[at];
+      int cur = rowIndexDepth(at), last = cur < d ? 0 : -1, lastquote = 0;
+      quote = 0;
+      for (j = 0; j < to; j++) {
+        cur += editorBracketStep(r->chars, j, &quote);
+        if (cur < d) {
+          last = j + 1;
+          lastquote = quote;
+        }
+      }
+      if (last != -1) {
+        quote = lastquote;
+        for (j = last; j < to && editorBracketStep(r->chars, j, &quote) <= 0; j++);
+        target = at;
+        col = j;
+        break;
+      }
+      at = rowIndexLastBelow(ECONFIG.rowindex.root, 0, 0, at - 1, d);
+      if (at != -1) to = ECONFIG.row[at].size;
+    }
+  }
+
+  if (target == -1) {
+    editorSetStatusMessage("No matching bracket");
+    return;
+  }
+  ECONFIG.cy = target;
+  ECONFIG.cx = col;
+}
+
+/*** folds and wrapping ***/
+
+/*
+ * A fold hides the rows below its first row, which stays on screen. Each fold adds one
+ * to the cover count of the rows it hides, applied to whole subtrees of the row index
+ * with a pending tag, and every subtree keeps its lowest cover and the screen lines of
+ * the rows that have it, so the screen line a row starts on and the row shown on a
+ * given screen line are both one walk down the tree no matter how much is folded.
+ *
+ * Folds nest but never overlap partly. An edit that adds or removes rows inside or at
+ * the head of a fold opens it first, so a fold always hides the rows it was made with.
+ *
+ * With soft wrap on, a row takes one screen line per wrapped segment. The count is
+ * cached in the row's node and only recomputed when the row changes or the width does.
+ */
+
+/* Screen lines of subtree t, add being the cover still pending from its ancestors */
+int rowIndexVisible(int t, int add) {
+  struct rowNode *n = &ECONFIG.rowindex.nodes[t];
+  return t && n->mincover + add == 0 ? n->minlines : 0;
+}
+
+/* Screen lines above row at */
+int rowIndexVisibleBefore(int at) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  int t = ECONFIG.rowindex.root, add = 0, count = 0;
+  while (t) {
+    struct rowNode *n = &nodes[t];
+    int left = nodes[n->left].size;
+    if (at <= left) {
+      t = n->left;
+    }
+    else {
+      count += rowIndexVisible(n->left, add + n->tag) + (n->cover + add == 0 ? n->lines : 0);
+      at -= left + 1;
+      t = n->right;
+    }
+    add += n->tag;
+  }
+  return count;
+}
+
+/* The row on screen line k counting from the top, *seg its segment there, or the row count past the end */
+int rowIndexVisibleRow(int k, int *seg) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  int t = ECONFIG.rowindex.root, add = 0, base = 0;
+  *seg = 0;
+  while (t) {
+    struct rowNode *n = &nodes[t];
+    int left = nodes[n->left].size;
+    int lv = rowIndexVisible(n->left, add + n->tag);
+    if (k < lv) {
+      t = n->left;
+    }
+    else {
+      k -= lv;
+      if (n->cover + add == 0) {
+        if (k < n->lines) {
+          *seg = k;
+          return base + left;
+        }
+        k -= n->lines;
+      }
+      base += left + 1;
+      t = n->right;
+    }
+    add += n->tag;
+  }
+  return nodes[ECONFIG.rowindex.root].size;
+}
+
+/* Number of folds hiding row at */
+int rowIndexCoverAt(int at) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  int t = ECONFIG.rowindex.root, add = 0;
+  while (t) {
+    struct rowNode *n = &nodes[t];
+    int left = nodes[n->left].size;
+    if (at == left) return n->cover + add;
+    add += n->tag;
+    if (at < left) {
+      t = n->left;
+    }
+    else {
+      at -= left + 1;
+      t = n->right;
+    }
+  }
+  return 0;
+}
+
+/* First row >= from in subtree t where a fold starts */
+int rowIndexFirstHead(int t, int base, int from) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  if (t == 0 || base + nodes[t].size <= from || nodes[t].heads == 0) return -1;
+  int r = rowIndexFirstHead(nodes[t].left, base, from);
+  if (r != -1) return r;
+  int at = base + nodes[nodes[t].left].size;
+  if (at >= from && nodes[t].foldlen) return at;
+  return rowIndexFirstHead(nodes[t].right, at + 1, from);
+}
+
+/* Add v to the cover of rows [from, from + n) */
+void rowIndexAddCover(int from, int n, int v) {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  int a, b, c;
+  rowIndexSplit(x->root, from, &a, &b);
+  rowIndexSplit(b, n, &b, &c);
+  rowIndexApply(b, v);
+  x->root = rowIndexMerge(rowIndexMerge(a, b), c);
+}
+
+/* Make row at head a fold over the len rows below it, or open its fold when len is 0 */
+void rowIndexSetFold(int at, int len) {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  int a, b, c;
+  rowIndexSplit(x->root, at, &a, &b);
+  rowIndexSplit(b, 1, &b, &c);
+  int old = x->nodes[b].foldlen;
+  x->nodes[b].foldlen = len;
+  rowIndexPull(b);
+  x->root = rowIndexMerge(rowIndexMerge(a, b), c);
+  if (old) rowIndexAddCover(at + 1, old, -1);
+  if (len) rowIndexAddCover(at + 1, len, 1);
+}
+
+int rowIndexFoldLen(int at) {
+  return ECONFIG.rowindex.nodes[rowIndexNode(at)].foldlen;
+}
+
+int editorFoldsActive() {
+  struct editorRowIndex *x = &ECONFIG.rowindex;
+  return x->built && x->nodes[x->root].heads > 0;
+}
+
+/* Rows do not map one to one to screen lines */
+int editorLinesMapped() {
+  return ECONFIG.wrap || editorFoldsActive();
+}
+
+/* Open the folds hiding row at, outermost first: its head is the last row shown above */
+void editorRevealRow(int at) {
+  if (!editorFoldsActive() || at >= ECONFIG.rowindex.nodes[ECONFIG.rowindex.root].size) return;
+  int seg;
+  while (rowIndexCoverAt(at) > 0) {
+    rowIndexSetFold(rowIndexVisibleRow(rowIndexVisibleBefore(at) - 1, &seg), 0);
+  }
+}
+
+/* Open every fold that rows [at, at + n) are about to be inserted into or deleted from */
+void rowIndexOpenFolds(int at, int n) {
+  int head;
+  if (!editorFoldsActive()) return;
+  editorRevealRow(at);
+  while ((head = rowIndexFirstHead(ECONFIG.rowindex.root, 0, at)) != -1 && head < at + n) {
+    rowIndexSetFold(head, 0);
+  }
+}
+
+/* Screen line row at starts on, counting from the top of the file */
+int editorLineOf(int at) {
+  return editorLinesMapped() ? rowIndexVisibleBefore(at) : at;
+}
+
+/* Row shown on screen line `line` counting from the top of the file, *seg its segment there */
+int editorLineRow(int line, int *seg) {
+  int at = line, s = 0;
+  if (line < 0) at = line = 0;
+  if (editorLinesMapped()) at = rowIndexVisibleRow(line, &s);
+  if (at >= ECONFIG.numrows) {
+    at = ECONFIG.numrows;
+    s = 0;
+  }
+  if (seg) *seg = s;
+  return at;
+}
+
+/* The row shown k screen lines below the start of row at, negative k going up */
+int editorRowAfter(int at, int k) {
+  return editorLineRow(editorLineOf(at) + k, NULL);
+}
+
+/* Screen lines between the starts of rows from and to */
+int editorRowsBetween(int from, int to) {
+  return editorLineOf(to) - editorLineOf(from);
+}
+
+/* The next row on screen after row at */
+int editorNextRow(int at) {
+  if (at >= ECONFIG.numrows) return ECONFIG.numrows;
+  return editorLineRow(editorLineOf(at + 1), NULL);
+}
+
+void rowIndexRewrapNode(int t, int base) {
+  struct rowNode *nodes = ECONFIG.rowindex.nodes;
+  if (t == 0) return;
+  int at = base + nodes[nodes[t].left].size;
+  rowIndexRewrapNode(nodes[t].left, base);
+  rowIndexRewrapNode(nodes[t].right, at + 1);
+  nodes[t].lines = ECONFIG.wrap ? editorWrapCount(&ECONFIG.row[at]) : 1;
+  rowIndexPull(t);
+}
+
+/* Recount the screen lines of every row, after wrapping was switched or the width changed */
+void rowIndexRewrap() {
+  if (ECONFIG.rowindex.built) rowIndexRewrapNode(ECONFIG.rowindex.root, 0);
+  else rowIndexBuild();
+  ECONFIG.wrapcols = ECONFIG.screencols;
+}
+
+void editorToggleWrap() {
+  ECONFIG.wrap = !ECONFIG.wrap;
+  ECONFIG.segoffset = 0;
+  ECONFIG.coloffset = 0;
+  rowIndexRewrap();
+  editorSetStatusMessage(ECONFIG.wrap ? "Soft wrap on" : "Soft wrap off");
+}
+
+/* Move the cursor d wrapped lines up or down, keeping its column within the segment */
+void editorMoveLine(int d) {
+  int seg = 0, start = 0, col = 0;
+  if (ECONFIG.cy < ECONFIG.numrows) {
+    editorRow *row = &ECONFIG.row[ECONFIG.cy];
+    int rx = editorRowCxToRx(row, ECONFIG.cx);
+    seg = editorWrapSegment(row, rx, &start);
+    col = rx - start;
+  }
+  int line = editorLineOf(ECONFIG.cy) + seg + d;
+  if (line < 0) return;
+
+  ECONFIG.cy = editorLineRow(line, &seg);
+  ECONFIG.cx = 0;
+  if (ECONFIG.cy < ECONFIG.numrows) {
+    editorRow *row = &ECONFIG.row[ECONFIG.cy];
+    for (start = 0; seg > 0; seg--) start = editorWrapEnd(row, start);
+    int end = editorWrapEnd(row, start);
+    int rx = editorRenderColumn(row, start) + col, endcol = editorRenderColumn(row, end);
+    if (rx >= endcol) rx = end < row->rsize ? endcol - 1 : endcol;
+    ECONFIG.cx = editorRowRxToCx(row, rx);
+  }
+}
+
+void editorToggleFold() {
+  if (ECONFIG.cy >= ECONFIG.numrows) return;
+  rowIndexBuild();
+  if (rowIndexFoldLen(ECONFIG.cy)) {
+    rowIndexSetFold(ECONFIG.cy, 0);
+    return;
+  }
+
+  int end = editorFoldEnd(ECONFIG.cy), head;
+  if (end == -1) {
+    editorSetStatusMessage("Nothing to fold here");
+    return;
+  }
+  /* folds inside that run past the end would overlap this one */
+  head = ECONFIG.cy + 1;
+  while ((head = rowIndexFirstHead(ECONFIG.rowindex.root, 0, head)) != -1 && head <= end) {
+    if (head + rowIndexFoldLen(head) > end) rowIndexSetFold(head, 0);
+    head++;
+  }
+  rowIndexSetFold(ECONFIG.cy, end - ECONFIG.cy);
+  ECONFIG.cx = 0;
+}
+
+/*** viewer ***/
+
+/*
+ * Read-only viewing of files too big to load as rows (-R). The file is mapped whole and
+ * read in place, and only the lines on screen are rendered, each through a scratch row
+ * cut to the bytes that can reach the screen. Line numbers come from a sparse index of
+ * the offset of every EDITOR_VIEW_MARK_LINES-th line, grown only as far as scrolling or
+ * a jump to a line needs, so a jump to a percentage of the file works before the index
+ * covers it. Resident memory stays under the budget by dropping the oldest chunks of the
+ * mapping that were read.
+ */
+
+/* Account for reading [off, off + len) of the mapping, dropping the oldest chunks over the budget */
+void viewTouch(off_t off, off_t len) {
+  struct editorView *v = &ECONFIG.view;
+  off_t c, last = (off + len - 1) / EDITOR_VIEW_CHUNK;
+  if (len <= 0) return;
+  for (c = off / EDITOR_VIEW_CHUNK; c <= last; c++) {
+    if (v->touched[c / 8] & (1 << (c % 8))) continue;
+    v->touched[c / 8] |= 1 << (c % 8);
+    v->ring[(v->head + v->count++) % v->ringcap] = c;
+    while (v->count > 1 && (size_t) v->count * EDITOR_VIEW_CHUNK > v->budget) {
+      off_t old = v->ring[v->head], start = old * EDITOR_VIEW_CHUNK;
+      off_t n = v->size - start < EDITOR_VIEW_CHUNK ? v->size - start : EDITOR_VIEW_CHUNK;
+      madvise((char *) v->map + start, n, MADV_DONTNEED);
+      v->touched[old / 8] &= ~(1 << (old % 8));
+      v->head = (v->head + 1) % v->ringcap;
+      v->count--;
+    }
+  }
+}
+
+/* End of the chunk holding off, or to if that comes first */
+off_t viewChunkEnd(off_t off, off_t to) {
+  off_t end = (off / EDITOR_VIEW_CHUNK + 1) * EDITOR_VIEW_CHUNK;
+  return end < to ? end : to;
+}
+
+/* Offset of the first newline in [from, to), or -1 */
+off_t viewFindNewline(off_t from, off_t to) {
+  const char *map = ECONFIG.view.map;
+  while (from < to) {
+    off_t end = viewChunkEnd(from, to);
+    viewTouch(from, end - from);
+    const char *p = memchr(map + from, '\n', end - from);
+    if (p) return p - map;
+    from = end;
+  }
+  return -1;
+}
+
+/* Newlines in [from, to) */
+long long viewCountLines(off_t from, off_t to) {
+  long long n = 0;
+  off_t nl;
+  while ((nl = viewFindNewline(from, to)) >= 0) {
+    from = nl + 1;
+    n++;
+  }
+  return n;
+}
+
+/* Start of the line holding the byte at off */
+off_t viewLineStart(off_t off) {
+  const char *map = ECONFIG.view.map;
+  while (off > 0) {
+    off_t start = (off - 1) / EDITOR_VIEW_CHUNK * EDITOR_VIEW_CHUNK;
+    viewTouch(start, off - start);
+    const char *p = memrchr(map + start, '\n', off - start);
+    if (p) return p - map + 1;
+    off = start;
+  }
+  return 0;
+}
+
+/* Start of the line after the one starting at off, -1 if that is the last one */
+off_t viewNextLine(off_t off) {
+  off_t nl = viewFindNewline(off, ECONFIG.view.size);
+  return nl < 0 || nl + 1 >= ECONFIG.view.size ? -1 : nl + 1;
+}
+
+/* Scan the file for line starts up to `until` */
+void viewIndexTo(off_t until) {
+  struct editorView *v = &ECONFIG.view;
+  if (until > v->size) until = v->size;
+  while (v->indexed < until) {
+    off_t end = viewChunkEnd(v->indexed, v->size);
+    const char *p = v->map + v->indexed, *stop = v->map + end;
+    viewTouch(v->indexed, end - v->indexed);
+    while ((p = memchr(p, '\n', stop - p)) != NULL) {
+      p++;
+      if (++v->lines % EDITOR_VIEW_MARK_LINES != 0) continue;
+      if (v->nummarks == v->markcap) {
+        v->markcap *= 2;
+        v->marks = realloc(v->marks, sizeof(off_t) * v->markcap);
+      }
+      v->marks[v->nummarks++] = p - v->map;
+    }
+    v->indexed = end;
+  }
+}
+
+/* Number of the line starting at off, -1 while the index doesn't reach it */
+long long viewLineOf(off_t off) {
+  struct editorView *v = &ECONFIG.view;
+  if (off > v->indexed) return -1;
+  long long lo = 0, hi = v->nummarks - 1;
+  while (lo < hi) {
+    long long mid = (lo + hi + 1) / 2;
+    if (v->marks[mid] <= off) lo = mid;
+    else hi = mid - 1;
+  }
+  return lo * EDITOR_VIEW_MARK_LINES + viewCountLines(v->marks[lo], off);
+}
+
+/* Start of line n, or of the last line if there are fewer; n is lowered to match */
+off_t viewLineOffset(long long *n) {
+  struct editorView *v = &ECONFIG.view;
+  while (v->lines < *n && v->indexed < v->size) viewIndexTo(v->indexed + EDITOR_VIEW_CHUNK);
+  if (*n > v->lines) *n = v->lines;
+  if (*n > 0 && *n == v->lines && v->map[v->size - 1] == '\n') --*n; /* nothing after the last newline */
+  off_t off = v->marks[*n / EDITOR_VIEW_MARK_LINES];
+  long long k;
+  for (k = 0; k < *n % EDITOR_VIEW_MARK_LINES; k++) off = viewFindNewline(off, v->size) + 1;
+  return off;
+}
+
+/* Line starts on screen, -1 past the end of the file, recomputed only when it scrolled */
+void viewScreen() {
+  struct editorView *v = &ECONFIG.view;
+  int y, rows = ECONFIG.screenrows;
+  if (v->starts && v->startstop == v->top && v->startsrows == rows) return;
+  v->starts = realloc(v->starts, sizeof(off_t) * (rows + 1));
+  v->startstop = v->top;
+  v->startsrows = rows;
+  off_t off = v->size > 0 ? v->top : -1;
+  for (y = 0; y <= rows; y++) {
+    v->starts[y] = off;
+    if (off >= 0) off = viewNextLine(off);
+  }
+
+  /* once the top line is numbered, the index follows the screen down */
+  if (v->topline < 0) v->topline = viewLineOf(v->top);
+  if (v->topline >= 0) viewIndexTo(v->starts[rows] >= 0 ? v->starts[rows] : v->size);
+}
+
+void viewSetTop(off_t off, long long line) {
+  ECONFIG.view.top = off;
+  ECONFIG.view.topline = line;
+}
+
+/* Move the top of the screen n lines down, or up when n is negative */
+void viewScroll(int n) {
+  struct editorView *v = &ECONFIG.view;
+  off_t off;
+  for (; n > 0 && (off = viewNextLine(v->top)) >= 0; n--) {
+    viewSetTop(off, v->topline >= 0 ? v->topline + 1 : -1);
+  }
+  for (; n < 0 && v->top > 0; n++) {
+    viewSetTop(viewLineStart(v->top - 1), v->topline >= 0 ? v->topline - 1 : -1);
+  }
+}
+
+/* Put the last line of the file at the bottom of the screen */
+void viewEnd() {
+  struct editorView *v = &ECONFIG.view;
+  viewSetTop(v->size > 0 ? viewLineStart(v->size - 1) : 0, -1);
+  viewScroll(-(ECONFIG.screenrows - 1));
+}
+
+/*
+ * Take in the file's new size: appended bytes are mapped in after the old ones and a
+ * complete line index goes on from where it stopped, so only the new bytes are read.
+ * A file that shrank was truncated or rewritten and is looked at from scratch. When the
+ * end of the file was on screen it stays there. Returns 1 if the size changed.
+ */
+int viewGrow() {
+  struct editorView *v = &ECONFIG.view;
+  struct stat st;
+  if (fstat(v->fd, &st) == -1 || st.st_size == v->size) return 0;
+  int atend;
+  if (st.st_size > v->size) {
+    viewScreen();
+    atend = v->starts[ECONFIG.screenrows] < 0;
+  }
+  else {
+    /* the old mapping may reach past the new end, go by the last screen drawn */
+    atend = v->starts == NULL || v->starts[v->startsrows] < 0;
+  }
+
+  size_t oldbits = v->size / EDITOR_VIEW_CHUNK / 8 + 1, bits = st.st_size / EDITOR_VIEW_CHUNK / 8 + 1;
+  if (st.st_size < v->size) {
+    munmap((char *) v->map, v->size);
+    v->map = NULL;
+    v->size = v->indexed = 0;
+    v->lines = 0;
+    v->nummarks = 1;
+    v->head = v->count = 0;
+    memset(v->touched, 0, oldbits);
+    viewSetTop(0, 0);
+  }
+  if (v->map) v->map = mremap((char *) v->map, v->size, st.st_size, MREMAP_MAYMOVE);
+  else if (st.st_size > 0) v->map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, v->fd, 0);
+  if (v->map == MAP_FAILED) die("mmap");
+  if (bits > oldbits) {
+    v->touched = realloc(v->touched, bits);
+    memset(v->touched + oldbits, 0, bits - oldbits);
+  }
+
+  int complete = v->indexed == v->size;
+  v->size = st.st_size;
+  if (complete) viewIndexTo(v->size);
+  v->startsrows = 0; /* the lines at the bottom may have grown */
+  if (atend) viewEnd();
+  return 1;
+}
+
+/* Start or stop following appends to the file, starting shows its end */
+void viewFollow(int on) {
+  struct editorView *v = &ECONFIG.view;
+  v->follow = on;
+#ifdef EDITOR_HAVE_INOTIFY
+  if (on && v->watch == -1) {
+    v->watch = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    if (v->watch != -1 && inotify_add_watch(v->watch, ECONFIG.filename, IN_MODIFY) == -1) {
+      close(v->watch);
+      v->watch = -1;
+    }
+  }
+  if (!on && v->watch != -1) {
+    close(v->watch);
+    v->watch = -1;
+  }
+#endif
+  if (!on) return;
+  /* small enough to number the lines as they come */
+  if (v->size <= (off_t) v->budget) viewIndexTo(v->size);
+  viewGrow();
+  viewEnd();
+}
+
+/*
+ * Called when idle: picks up appends to a followed file. Whatever was written since the
+ * last call is taken in at once, so a fast writer costs one pass over the new bytes and
+ * one redraw per idle tick, not one per write. Without inotify the size is checked on
+ * every tick. Returns 1 if the screen needs redrawing.
+ */
+int viewPoll() {
+  struct editorView *v = &ECONFIG.view;
+  if (!v->follow) return 0;
+#ifdef EDITOR_HAVE_INOTIFY
+  if (v->watch != -1) {
+    char buf[4096];
+    int events = 0;
+    while (read(v->watch, buf, sizeof(buf)) > 0) events = 1;
+    if (!events) return 0;
+  }
+#endif
+  return viewGrow();
+}
+
+/* Jump to a line number, or to a percentage of the file if the answer ends with % */
+void viewGoto() {
+  struct editorView *v = &ECONFIG.view;
+  char *answer = editorPrompt("Go to line or percentage: %s (ESC to cancel)", NULL);
+  if (answer == NULL) return;
+  char *end;
+  if (strchr(answer, '%')) {
+    double pct = strtod(answer, &end);
+    if (pct < 0) pct = 0;
+    off_t off = pct >= 100 ? v->size : (off_t) (v->size * (pct / 100));
+    if (off >= v->size) off = v->size - 1;
+    viewSetTop(off > 0 ? viewLineStart(off) : 0, -1);
+  }
+  else {
+    long long n = strtoll(answer, &end, 10) - 1;
+    if (n < 0) n = 0;
+    off_t off = viewLineOffset(&n);
+    viewSetTop(off, n);
+  }
+  free(answer);
+}
+
+void viewHelp() {
+  editorSetStatusMessage("Read-only view: Ctrl-G = go to line or %% | Ctrl-F = follow | Ctrl-Q = quit");
+}
+
+/* Keys while viewing, returns 0 for the ones handled as usual */
+int viewProcessKey(int c) {
+  struct editorView *v = &ECONFIG.view;
+  switch (c) {
+    case CTRL_KEY('q'):
+      return 0;
+    case ARROW_UP:
+    case ARROW_DOWN:
+      viewScroll(c == ARROW_UP ? -1 : 1);
+      break;
+    case PAGE_UP:
+    case PAGE_DOWN:
+      viewScroll(c == PAGE_UP ? -ECONFIG.screenrows : ECONFIG.screenrows);
+      break;
+    case ARROW_LEFT:
+      v->coloffset -= ECONFIG.screencols / 2;
+      if (v->coloffset < 0) v->coloffset = 0;
+      break;
+    case ARROW_RIGHT:
+      v->coloffset += ECONFIG.screencols / 2;
+      break;
+    case HOME_KEY:
+      viewSetTop(0, 0);
+      v->coloffset = 0;
+      break;
+    case END_KEY:
+      viewEnd();
+      break;
+    case CTRL_KEY('f'):
+      viewFollow(!v->follow);
+      editorSetStatusMessage(v->follow ? "Following appends to the file" : "Stopped following");
+      break;
+    case CTRL_KEY('g'):
+      viewGoto();
+      break;
+    case CTRL_KEY('l'):
+    case '\x1b':
+    case PASTE_END:
+      break;
+    default:
+      viewHelp();
+      break;
+  }
+  return 1;
+}
+
+/* Draw the screen columns [coloffset, coloffset + cols) of a line of text through a scratch row, without colors */
+void editorDrawText(struct appendbuffer *ab, const char *s, size_t len, int coloffset, int cols) {
+  /* only the bytes that can reach the screen, a character is at most 4 of them */
+  size_t most = 4 * ((size_t) coloffset + cols + 1);
+  editorRow row;
+  memset(&row, 0, sizeof(row));
+  row.chars = (char *) s;
+  row.size = len < most ? len : most;
+  editorUpdateRow(&row);
+  int at = editorRenderAt(&row, coloffset), pad = 0;
+  if (at < row.rsize) pad = editorRenderColumn(&row, at) - coloffset;
+  int stop = editorRenderFit(&row, at, cols - pad);
+  while (pad-- > 0) aBufferAppend(ab, " ", 1);
+  aBufferAppend(ab, &row.render[at], stop - at);
+  free(row.render);
+  free(row.colmarks);
+}
+
+void viewDrawRows(struct appendbuffer *ab) {
+  struct editorView *v = &ECONFIG.view;
+  int y, cols = ECONFIG.screencols;
+  viewScreen();
+  for (y = 0; y < ECONFIG.screenrows; y++) {
+    off_t off = v->starts[y];
+    if (off < 0) {
+      aBufferAppend(ab, "~", 1);
+    }
+    else {
+      /* only the bytes that can reach the screen, a character is at most 4 of them */
+      off_t end = off + 4 * ((off_t) v->coloffset + cols + 1);
+      if (end > v->size) end = v->size;
+      off_t nl = viewFindNewline(off, end);
+      if (nl >= 0) end = nl > off && v->map[nl - 1] == '\r' ? nl - 1 : nl;
+      editorDrawText(ab, v->map + off, end - off, v->coloffset, cols);
+    }
+    aBufferAppend(ab, "\x1b[K", 3);
+    aBufferAppend(ab, "\r\n", 2);
+  }
+}
+
+/* Right side of the status bar: line when numbered, out of how many once fully indexed */
+int viewPosition(char *buf, size_t size) {
+  struct editorView *v = &ECONFIG.view;
+  char line[32] = "?", total[32] = "?";
+  int pct = v->size > 0 ? (int) (v->top * 100 / v->size) : 100;
+  if (v->topline >= 0) snprintf(line, sizeof(line), "%lld", v->topline + 1);
+  if (v->indexed == v->size) {
+    snprintf(total, sizeof(total), "%lld", v->lines + (v->size == 0 || v->map[v->size - 1] != '\n'));
+    return snprintf(buf, size, "%s / %s | %d%%", line, total, pct);
+  }
+  return snprintf(buf, size, "%s / %s | %d%% | indexed %d%%", line, total, pct, (int) (v->indexed * 100 / v->size));
+}
+
+void viewOpen(char *filename) {
+  struct editorView *v = &ECONFIG.view;
+  free(ECONFIG.filename);
+  ECONFIG.filename = strdup(filename);
+
+  int fd = open(filename, O_RDONLY);
+  if (fd == -1) die("open");
+  struct stat st;
+  if (fstat(fd, &st) == -1) die("fstat");
+  v->size = st.st_size;
+  if (v->size > 0) {
+    v->map = mmap(NULL, v->size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (v->map == MAP_FAILED) die("mmap");
+  }
+  v->fd = fd;
+  v->watch = -1;
+
+  if (v->budget < EDITOR_VIEW_CHUNK) v->budget = EDITOR_VIEW_CHUNK;
+  v->touched = calloc((v->size / EDITOR_VIEW_CHUNK) / 8 + 1, 1);
+  v->ringcap = v->budget / EDITOR_VIEW_CHUNK + 2;
+  v->ring = malloc(sizeof(off_t) * v->ringcap);
+  v->markcap = 1024;
+  v->marks = malloc(sizeof(off_t) * v->markcap);
+  v->marks[0] = 0;
+  v->nummarks = 1;
+  v->active = 1;
+  viewHelp();
+}
+
+void viewClose() {
+  struct editorView *v = &ECONFIG.view;
+  size_t budget = v->budget;
+  if (v->active) {
+    close(v->fd);
+    if (v->watch != -1) close(v->watch);
+  }
+  if (v->map) munmap((char *) v->map, v->size);
+  free(v->touched);
+  free(v->ring);
+  free(v->marks);
+  free(v->starts);
+  memset(v, 0, sizeof(*v));
+  v->budget = budget;
+}
+
+/*** diff ***/
+
+/*
+ * Line diff of the buffer against a file, for reloads and the compare view (Ctrl-D).
+ * Lines are compared by a 64-bit hash: the rows cache theirs (editorRowHash()), the
+ * lines of the file are hashed once when it is read, and a pair the hashes match is
+ * checked byte by byte afterwards. The common head and tail are stripped by comparing
+ * bytes, and lines with no equal on the other side are marked changed up front. What
+ * is left goes through Myers' O(ND) algorithm in its linear space form, which searches
+ * from both ends at once for the middle of a shortest edit script and splits there.
+ * A search that runs for EDITOR_DIFF_COST rounds settles for the furthest point either
+ * end reached, which bounds the time on files that share little but in another order.
+ * The result is a mark on every line of either side that is not in the other.
+ *
+ * The compare view shows both sides inline, in a mode of its own like the viewer: the
+ * buffer's rows with the lines only in the file interleaved, until Esc.
+ */
+
+struct diffContext {
+  const uint64_t *a, *b;
+  int *fdiag, *bdiag; /* furthest x reached on each diagonal x - y, searching forwards and backwards */
+  int cost; /* rounds of a search before it settles */
+};
+
+/* Find where a shortest edit script from (xoff, yoff) to (xlim, ylim) crosses its middle */
+void diffMiddle(struct diffContext *dc, int xoff, int xlim, int yoff, int ylim, int *xmid, int *ymid) {
+  const uint64_t *a = dc->a, *b = dc->b;
+  int *fd = dc->fdiag, *bd = dc->bdiag;
+  int dmin = xoff - ylim, dmax = xlim - yoff;
+  int fmid = xoff - yoff, bmid = xlim - ylim;
+  int fmin = fmid, fmax = fmid, bmin = bmid, bmax = bmid;
+  int odd = (fmid - bmid) & 1; /* the paths meet on a forward step, else on a backward one */
+  int c, d;
+
+  fd[fmid] = xoff;
+  bd[bmid] = xlim;
+  for (c = 1;; c++) {
+    if (fmin > dmin) fd[--fmin - 1] = -1;
+    else fmin++;
+    if (fmax < dmax) fd[++fmax + 1] = -1;
+    else fmax--;
+    for (d = fmax; d >= fmin; d -= 2) {
+      int lo = fd[d - 1], hi = fd[d + 1];
+      int x = lo >= hi ? lo + 1 : hi, y = x - d;
+      while (x < xlim && y < ylim && a[x] == b[y]) {
+        x++;
+        y++;
+      }
+      fd[d] = x;
+      if (odd && bmin <= d && d <= bmax && bd[d] <= x) {
+        *xmid = x;
+        *ymid = y;
+        return;
+      }
+    }
+
+    if (bmin > dmin) bd[--bmin - 1] = INT_MAX;
+    else bmin++;
+    if (bmax < dmax) bd[++bmax + 1] = INT_MAX;
+    else bmax--;
+    for (d = bmax; d >= bmin; d -= 2) {
+      int lo = bd[d - 1], hi = bd[d + 1];
+      int x = lo < hi ? lo : hi - 1, y = x - d;
+      while (x > xoff && y > yoff && a[x - 1] == b[y - 1]) {
+        x--;
+        y--;
+      }
+      bd[d] = x;
+      if (!odd && fmin <= d && d <= fmax && x <= fd[d]) {
+        *xmid = x;
+        *ymid = y;
+        return;
+      }
+    }
+
+    if (c >= dc->cost) {
+      /* too expensive: split where one of the searches got furthest */
+      int fbest = -1, fx = 0, bbest = INT_MAX, bx = 0;
+      for (d = fmax; d >= fmin; d -= 2) {
+        int x = fd[d] < xlim ? fd[d] : xlim, y = x - d;
+        if (y > ylim) {
+          x = ylim + d;
+          y = ylim;
+        }
+        if (x + y > fbest) {
+          fbest = x + y;
+          fx = x;
+        }
+      }
+      for (d = bmax; d >= bmin; d -= 2) {
+        int x = bd[d] > xoff ? bd[d] : xoff, y = x - d;
+        if (y < yoff) {
+          x = yoff + d;
+          y = yoff;
+        }
+        if (x + y < bbest) {
+          bbest = x + y;
+          bx = x;
+        }
+      }
+      if (xlim + ylim - bbest < fbest - (xoff + yoff)) {
+        *xmid = fx;
+        *ymid = fbest - fx;
+      }
+      else {
+        *xmid = bx;
+        *ymid = bbest - bx;
+      }
+      return;
+    }
+  }
+}
+
+/* Mark the lines of a[0, n) not in b[0, m) in changeda and the other way round in changedb */
+void diffSequences(const uint64_t *a, int n, const uint64_t *b, int m, unsigned char *changeda, unsigned char *changedb) {
+  struct diffContext dc;
+  int *diags = malloc(sizeof(int) * 2 * (n + m + 3));
+  dc.a = a;
+  dc.b = b;
+  dc.fdiag = diags + m + 1;
+  dc.bdiag = diags + (n + m + 3) + m + 1;
+  dc.cost = EDITOR_DIFF_COST;
+
+  /* ranges still to compare, an explicit stack since a split can be lopsided */
+  int cap = 64, top = 0, j;
+  int (*stack)[4] = malloc(sizeof(*stack) * cap);
+  stack[top][0] = 0;
+  stack[top][1] = n;
+  stack[top][2] = 0;
+  stack[top++][3] = m;
+  while (top > 0) {
+    top--;
+    int xoff = stack[top][0], xlim = stack[top][1], yoff = stack[top][2], ylim = stack[top][3];
+    while (xoff < xlim && yoff < ylim && a[xoff] == b[yoff]) {
+      xoff++;
+      yoff++;
+    }
+    while (xoff < xlim && yoff < ylim && a[xlim - 1] == b[ylim - 1]) {
+      xlim--;
+      ylim--;
+    }
+    int xmid = xoff, ymid = yoff;
+    if (xoff < xlim && yoff < ylim) diffMiddle(&dc, xoff, xlim, yoff, ylim, &xmid, &ymid);
+    if (xoff == xlim || yoff == ylim || (xmid == xoff && ymid == yoff) || (xmid == xlim && ymid == ylim)) {
+      for (j = xoff; j < xlim; j++) changeda[j] = 1;
+      for (j = yoff; j < ylim; j++) changedb[j] = 1;
+      continue;
+    }
+    if (top + 2 > cap) stack = realloc(stack, sizeof(*stack) * (cap *= 2));
+    stack[top][0] = xoff;
+    stack[top][1] = xmid;
+    stack[top][2] = yoff;
+    stack[top++][3] = ymid;
+    stack[top][0] = xmid;
+    stack[top][1] = xlim;
+    stack[top][2] = ymid;
+    stack[top++][3] = ylim;
+  }
+  free(stack);
+  free(diags);
+}
+
+/* Set of hashes, open addressing with linear probing */
+struct diffSet {
+  uint64_t *slots;
+  unsigned char *used;
+  size_t mask;
+};
+
+void diffSetInit(struct diffSet *set, const uint64_t *h, int n) {
+  size_t size = 16, j;
+  while (size < 2 * (size_t) n) size *= 2;
+  set->slots = malloc(sizeof(uint64_t) * size);
+  set->used = calloc(size, 1);
+  set->mask = size - 1;
+  for (j = 0; j < (size_t) n; j++) {
+    size_t k = h[j] & set->mask;
+    while (set->used[k] && set->slots[k] != h[j]) k = (k + 1) & set->mask;
+    set->slots[k] = h[j];
+    set->used[k] = 1;
+  }
+}
+
+int diffSetHas(struct diffSet *set, uint64_t h) {
+  size_t k = h & set->mask;
+  while (set->used[k]) {
+    if (set->slots[k] == h) return 1;
+    k = (k + 1) & set->mask;
+  }
+  return 0;
+}
+
+void diffSetFree(struct diffSet *set) {
+  free(set->slots);
+  free(set->used);
+}
+
+/* Keep the lines of h[0, n) that are in the set, marking the others changed, returns how many were kept */
+int diffMatchable(const uint64_t *h, int n, struct diffSet *other, uint64_t *kept, int *at, unsigned char *changed) {
+  int j, k = 0;
+  for (j = 0; j < n; j++) {
+    if (diffSetHas(other, h[j])) {
+      kept[k] = h[j];
+      at[k++] = j;
+    }
+    else {
+      changed[j] = 1;
+    }
+  }
+  return k;
+}
+
+/* diffSequences() on the lines that have an equal on the other side, the others are changed anyway */
+void diffLines(const uint64_t *a, int n, const uint64_t *b, int m, unsigned char *changeda, unsigned char *changedb) {
+  uint64_t *keptb = malloc(sizeof(uint64_t) * (n + m + 1)), *kepta = keptb + m;
+  int *atb = malloc(sizeof(int) * (n + m + 1)), *ata = atb + m;
+  unsigned char *marks = calloc(n + m + 1, 1);
+  struct diffSet set;
+  int na, nb, j;
+
+  diffSetInit(&set, b, m);
+  na = diffMatchable(a, n, &set, kepta, ata, changeda);
+  diffSetFree(&set);
+  diffSetInit(&set, a, n);
+  nb = diffMatchable(b, m, &set, keptb, atb, changedb);
+  diffSetFree(&set);
+
+  diffSequences(kepta, na, keptb, nb, marks, marks + na);
+  for (j = 0; j < na; j++) if (marks[j]) changeda[ata[j]] = 1;
+  for (j = 0; j < nb; j++) if (marks[na + j]) changedb[atb[j]] = 1;
+  free(keptb);
+  free(atb);
+  free(marks);
+}
+
+/* Mark the rows of the buffer not in a file split at lineoff, and its lines not in the buffer */
+void diffRowsWithFile(const char *map, const off_t *lineoff, int numlines, unsigned char *changedrows, unsigned char *changedlines) {
+  int numrows = ECONFIG.numrows, head = 0, tail = 0, i, j;
+
+  /* the common head and tail only need their bytes compared, the rest is hashed and diffed */
+  while (head < numrows && head < numlines && editorRowIsLine(&ECONFIG.row[head], map, lineoff, head)) head++;
+  while (tail < numrows - head && tail < numlines - head &&
+    editorRowIsLine(&ECONFIG.row[numrows - 1 - tail], map, lineoff, numlines - 1 - tail)) {
+    tail++;
+  }
+  int n = numrows - head - tail, m = numlines - head - tail;
+  uint64_t *a = malloc(sizeof(uint64_t) * (n + 1)), *b = malloc(sizeof(uint64_t) * (m + 1));
+  for (i = 0; i < n; i++) a[i] = editorRowHash(&ECONFIG.row[head + i]);
+  for (j = 0; j < m; j++) b[j] = editorHash64(map + lineoff[head + j], editorDiskLineLen(map, lineoff, head + j));
+  diffLines(a, n, b, m, changedrows + head, changedlines + head);
+
+  /* a hash match still has to be the same line */
+  i = j = head;
+  while (i < numrows - tail && j < numlines - tail) {
+    if (changedrows[i]) {
+      i++;
+    }
+    else if (changedlines[j]) {
+      j++;
+    }
+    else {
+      if (!editorRowIsLine(&ECONFIG.row[i], map, lineoff, j)) changedrows[i] = changedlines[j] = 1;
+      i++;
+      j++;
+    }
+  }
+  free(a);
+  free(b);
+}
+
+void compareClose() {
+  struct editorCompare *cmp = &ECONFIG.compare;
+  if (cmp->map) munmap(cmp->map, cmp->size);
+  free(cmp->path);
+  free(cmp->lineoff);
+  free(cmp->lines);
+  memset(cmp, 0, sizeof(*cmp));
+}
+
+void compareScroll(int lines) {
+  struct editorCompare *cmp = &ECONFIG.compare;
+  int last = cmp->numshown > ECONFIG.screenrows ? cmp->numshown - ECONFIG.screenrows : 0;
+  /* down no further than the last screen, which a jump to a change may have passed already */
+  if (lines > 0 && cmp->top + lines > last) lines = last > cmp->top ? last - cmp->top : 0;
+  cmp->top += lines;
+  if (cmp->top < 0) cmp->top = 0;
+  if (cmp->current < cmp->top || cmp->current >= cmp->top + ECONFIG.screenrows) cmp->current = cmp->top;
+}
+
+/* Jump to the change after the current one, or before it */
+void compareNextChange(int dir) {
+  struct editorCompare *cmp = &ECONFIG.compare;
+  struct diffLine *lines = cmp->lines;
+  int k;
+  for (k = cmp->current + dir; k >= 0 && k < cmp->numshown; k += dir) {
+    if (lines[k].type != DIFF_SAME && (k == 0 || lines[k - 1].type == DIFF_SAME)) {
+      cmp->current = k;
+      cmp->top = k > EDITOR_DIFF_CONTEXT ? k - EDITOR_DIFF_CONTEXT : 0;
+      return;
+    }
+  }
+  editorSetStatusMessage(dir > 0 ? "No more changes below" : "No more changes above");
+}
+
+void compareHelp() {
+  editorSetStatusMessage("Compare: n/p = next/previous change | Enter = go to row | Ctrl-O = other file");
+}
+
+/* Show how the buffer differs from a file, returns -1 if the file can't be read */
+int compareOpen(const char *path) {
+  struct editorCompare *cmp = &ECONFIG.compare;
+  int fd = open(path, O_RDONLY);
+  struct stat st;
+  if (fd == -1 || fstat(fd, &st) == -1) {
+    editorSetStatusMessage("Can't compare with %s: %s", path, strerror(errno));
+    if (fd != -1) close(fd);
+    return -1;
+  }
+  char *map = NULL;
+  if (st.st_size > 0 && (map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED) {
+    editorSetStatusMessage("Can't compare with %s: %s", path, strerror(errno));
+    close(fd);
+    return -1;
+  }
+  close(fd);
+
+  compareClose();
+  cmp->path = strdup(path);
+  cmp->map = map;
+  cmp->size = st.st_size;
+  cmp->lineoff = editorSplitLines(map, st.st_size, &cmp->numlines);
+  unsigned char *changedrows = calloc(ECONFIG.numrows + 1, 1), *changedlines = calloc(cmp->numlines + 1, 1);
+  diffRowsWithFile(map, cmp->lineoff, cmp->numlines, changedrows, changedlines);
+
+  /* a screen line per row or line, what the file has in a change shown before what the buffer has */
+  int i = 0, j = 0;
+  cmp->lines = malloc(sizeof(struct diffLine) * (ECONFIG.numrows + cmp->numlines + 1));
+  while (i < ECONFIG.numrows || j < cmp->numlines) {
+    struct diffLine *d = &cmp->lines[cmp->numshown++];
+    if (j < cmp->numlines && (changedlines[j] || i == ECONFIG.numrows)) {
+      d->type = DIFF_OLD;
+      d->line = j++;
+      cmp->removed++;
+    }
+    else if (changedrows[i] || j == cmp->numlines) {
+      d->type = DIFF_NEW;
+      d->line = i++;
+      cmp->added++;
+    }
+    else {
+      d->type = DIFF_SAME;
+      d->line = i++;
+      j++;
+    }
+    if (d->type != DIFF_SAME && (cmp->numshown == 1 || d[-1].type == DIFF_SAME)) cmp->hunks++;
+  }
+  free(changedrows);
+  free(changedlines);
+
+  if (cmp->hunks == 0) {
+    editorSetStatusMessage("No differences with %s", path);
+    compareClose();
     return 0;
   }
+  cmp->active = 1;
+  cmp->current = -1;
+  compareNextChange(1);
+  compareHelp();
+  return 0;
 }
 
-int editorRowCxToRx(editorRow *row, int cx) {
-  int rx = 0;
-  int j;
-  for (j = 0; j < cx; j++) {
-    if (row->chars[j] == '\t') {
-      rx += (EDITOR_TAB_STOP - 1) - (rx % EDITOR_TAB_STOP);
-    }
-    rx++;
+/* Ask for a file to compare the buffer with */
+void comparePrompt() {
+  char *path = editorPrompt("Compare with: %s (ESC to cancel)", NULL);
+  if (path) {
+    compareOpen(path);
+    free(path);
   }
-  return rx;
 }
 
-void editorUpdateRow(editorRow *row) {
-  int tabs = 0;
-  int j;
-  for (j = 0; j < row->size; j++) {
-    if (row->chars[j] == '\t') tabs++;
-  }
+/* Leave the compare view at the row of the buffer on the current line, or the one after it */
+void compareGoto() {
+  struct editorCompare *cmp = &ECONFIG.compare;
+  int k = cmp->current;
+  while (k < cmp->numshown && cmp->lines[k].type == DIFF_OLD) k++;
+  ECONFIG.cy = k < cmp->numshown ? cmp->lines[k].line : ECONFIG.numrows;
+  ECONFIG.cx = 0;
+  if (ECONFIG.cy < ECONFIG.numrows) editorRevealRow(ECONFIG.cy);
+  compareClose();
+}
 
-  free(row->render);
-  row->render = malloc(row->size + tabs*(EDITOR_TAB_STOP - 1) + 1);
+/* Keys while comparing, all of them are taken */
+void compareProcessKey(int c) {
+  struct editorCompare *cmp = &ECONFIG.compare;
+  switch (c) {
+    case CTRL_KEY('q'):
+    case CTRL_KEY('d'):
+    case '\x1b':
+      compareClose();
+      break;
+    case '\r':
+      compareGoto();
+      break;
+    case 'n':
+    case 'p':
+      compareNextChange(c == 'n' ? 1 : -1);
+      break;
+    case ARROW_UP:
+    case ARROW_DOWN:
+      compareScroll(c == ARROW_UP ? -1 : 1);
+      break;
+    case PAGE_UP:
+    case PAGE_DOWN:
+      compareScroll(c == PAGE_UP ? -ECONFIG.screenrows : ECONFIG.screenrows);
+      break;
+    case ARROW_LEFT:
+      cmp->coloffset -= ECONFIG.screencols / 2;
+      if (cmp->coloffset < 0) cmp->coloffset = 0;
+      break;
+    case ARROW_RIGHT:
+      cmp->coloffset += ECONFIG.screencols / 2;
+      break;
+    case HOME_KEY:
+      cmp->top = cmp->coloffset = cmp->current = 0;
+      break;
+    case END_KEY:
+      compareScroll(cmp->numshown);
+      break;
+    case CTRL_KEY('o'):
+      comparePrompt();
+      break;
+    case CTRL_KEY('l'):
+    case PASTE_END:
+      break;
+    default:
+      compareHelp();
+      break;
+  }
+}
 
-  int idx = 0;
-  for (j = 0; j < row->size; j++) {
-    if (row->chars[j] == '\t') {
-      row->render[idx++] = ' ';
-      while (idx % EDITOR_TAB_STOP != 0) row->render[idx++] = ' ';
+/* Both sides inline: rows only in the buffer after a +, lines only in the file after a - */
+void compareDrawRows(struct appendbuffer *ab) {
+  struct editorCompare *cmp = &ECONFIG.compare;
+  int y;
+  for (y = 0; y < ECONFIG.screenrows; y++) {
+    int k = cmp->top + y;
+    if (k >= cmp->numshown) {
+      aBufferAppend(ab, "~", 1);
     }
     else {
-      row->render[idx++] = row->chars[j];
+      struct diffLine *d = &cmp->lines[k];
+      if (d->type == DIFF_OLD) {
+        aBufferAppend(ab, "\x1b[31m-", 6);
+        editorDrawText(ab, cmp->map + cmp->lineoff[d->line], editorDiskLineLen(cmp->map, cmp->lineoff, d->line),
+          cmp->coloffset, ECONFIG.screencols - 1);
+      }
+      else {
+        editorRow *row = &ECONFIG.row[d->line];
+        aBufferAppend(ab, d->type == DIFF_NEW ? "\x1b[32m+" : " ", d->type == DIFF_NEW ? 6 : 1);
+        editorDrawText(ab, row->chars, row->size, cmp->coloffset, ECONFIG.screencols - 1);
+      }
+      if (d->type != DIFF_SAME) aBufferAppend(ab, "\x1b[m", 3);
     }
+    aBufferAppend(ab, "\x1b[K", 3);
+    aBufferAppend(ab, "\r\n", 2);
   }
-  row->render[idx] = '\0';
-  row->rsize = idx;
 }
 
-void editorInsertRow(int at, char *s, size_t len) {
-  if (at < 0 || at > ECONFIG.numrows) return;
-
-  ECONFIG.row = realloc(ECONFIG.row, sizeof(editorRow) * (ECONFIG.numrows + 1));
-  memmove(&ECONFIG.row[at + 1], &ECONFIG.row[at], sizeof(editorRow) * (ECONFIG.numrows - at));
+/*** syntax highlighting ***/
 
-  ECONFIG.row[at].size = len;
-  ECONFIG.row[at].chars = malloc(len + 1);
-  memcpy(ECONFIG.row[at].chars, s, len);
-  ECONFIG.row[at].chars[len] = '\0';
+/*
+ * Each row keeps a highlight class per render column in hl and the lexer state at its end,
+ * so a row can be lexed on its own given the state of the row above. Highlighting is lazy:
+ * before drawing, rows from hlfrom down to a little past the bottom of the screen are
+ * brought up to date. Edits only lower hlfrom to the first touched row, and from there a
+ * row is relexed only if its text changed or it now starts in a different state, so the
+ * work after an edit stops as soon as the states converge again.
+ */
 
-  ECONFIG.row[at].rsize = 0;
-  ECONFIG.row[at].render = NULL;
-  editorUpdateRow(&ECONFIG.row[at]);
+#ifndef EDITOR_LEXGEN
+#include "lexers.h"
+#else
+const struct lexTable lexC, lexJSON, lexYAML, lexShell; /* being generated */
+#endif
 
-  ECONFIG.numrows++;
-  ECONFIG.dirty++;
-}
+/*
+ * Longest-match tokenizer, lexes s[from, to) into hl from the given DFA state and returns
+ * the state it ends in, *start is where the token in progress began. The tables are total
+ * (see lexgen.c), so this is one lookup per byte: each state's value holds its class and
+ * condition, whether it starts a token, and whether the token so far must take its class,
+ * as when "in" turns out to be "int".
+ */
+unsigned lexRun(const struct lexTable *t, const unsigned char *s, unsigned char *hl, int from, int to,
+    unsigned state, int *start) {
+  const unsigned char *byteclass = t->byteclass;
+  const uint16_t *next = t->next;
+  int value = t->numclasses;
+  int j;
 
-void editorFreeRow(editorRow *row) {
-  free(row->render);
-  free(row->chars);
+  for (j = from; j < to; j++) {
+    state = next[state + byteclass[s[j]]];
+    unsigned v = next[state + value];
+    *start = v & LEX_FRESH ? j : *start;
+    hl[j] = v & 15;
+    if (v & LEX_FIX) memset(&hl[*start], v & 15, j - *start);
+  }
+  return state;
 }
 
-void editorDelRow(int at) {
-  if (at < 0 || at >= ECONFIG.numrows) return;
-  editorFreeRow(&ECONFIG.row[at]);
-  memmove(&ECONFIG.row[at], &ECONFIG.row[at + 1], sizeof(editorRow) * (ECONFIG.numrows - at - 1));
-  ECONFIG.numrows--;
-  ECONFIG.dirty++;
+/* Condition after the token the lexer is in the middle of */
+int lexCondition(const struct lexTable *t, unsigned state) {
+  return t->next[state + t->numclasses] >> 4 & 15;
 }
 
-void editorRowInsertChar(editorRow *row, int at, int c) {
-  if (at < 0 || at > row->size) at = row->size;
-  row->chars = realloc(row->chars, row->size + 2);
-  memmove(&row->chars[at + 1], &row->chars[at], row->size - at + 1);
-  row->size++;
-  row->chars[at] = c;
-  editorUpdateRow(row);
-  ECONFIG.dirty++;
+int lexRow(const struct lexTable *t, editorRow *row, int cond) {
+  int start = 0;
+  unsigned state = lexRun(t, (const unsigned char *) row->render, row->hl, 0, row->rsize, t->start[cond], &start);
+  return lexCondition(t, state);
 }
 
-void editorRowAppendString(editorRow *row, char *s, size_t len) {
-  row->chars = realloc(row->chars, row->size + len + 1);
-  memcpy(&row->chars[row->size], s, len);
-  row->size += len;
-  row->chars[row->size] = '\0';
-  editorUpdateRow(row);
-  ECONFIG.dirty++;
-}
+const char *C_HL_extensions[] = {".c", ".h", ".cpp", ".cc", ".hpp", NULL};
+const char *JSON_HL_extensions[] = {".json", NULL};
+const char *YAML_HL_extensions[] = {".yaml", ".yml", NULL};
+const char *Shell_HL_extensions[] = {".sh", ".bash", "bashrc", NULL};
 
-void editorRowDelChar(editorRow *row, int at) {
-  if (at < 0 || at >= row->size) return;
-  memmove(&row->chars[at], &row->chars[at + 1], row->size - at);
-  row->size--;
-  editorUpdateRow(row);
-  ECONFIG.dirty++;
-}
+struct editorSyntax HLDB[] = {
+  {"c", C_HL_extensions, &lexC},
+  {"json", JSON_HL_extensions, &lexJSON},
+  {"yaml", YAML_HL_extensions, &lexYAML},
+  {"sh", Shell_HL_extensions, &lexShell},
+};
 
-void editorInsertChar(int c) {
-  if (ECONFIG.cy == ECONFIG.numrows) {
-    editorInsertRow(ECONFIG.numrows, "", 0);
+/* Pick the syntax for the current file name, everything is relexed on the next draw */
+void editorSelectSyntax() {
+  unsigned int j;
+  int k;
+  hlStop();
+  ECONFIG.syntax = NULL;
+  ECONFIG.hlfrom = 0;
+  for (k = 0; k < ECONFIG.numrows; k++) {
+    ECONFIG.row[k].hl_version = ECONFIG.row[k].version - 1;
+    hlFreeSlot(ECONFIG.row[k].hlslot);
+    ECONFIG.row[k].hlslot = NULL;
   }
-  editorRowInsertChar(&ECONFIG.row[ECONFIG.cy], ECONFIG.cx, c);
-  ECONFIG.cx++;
-}
+  if (ECONFIG.filename == NULL) return;
 
-void editorInsertNewLine() {
-  if (ECONFIG.cx == 0) {
-    editorInsertRow(ECONFIG.cy, "", 0);
-  }
-  else {
-    editorRow *row = &ECONFIG.row[ECONFIG.cy];
-    editorInsertRow(ECONFIG.cy + 1, &row->chars[ECONFIG.cx], row->size - ECONFIG.cx);
-    row = &ECONFIG.row[ECONFIG.cy];
-    row->size = ECONFIG.cx;
-    row->chars[row->size] = '\0';
-    editorUpdateRow(row);
+  char *ext = strrchr(ECONFIG.filename, '.');
+  for (j = 0; j < sizeof(HLDB) / sizeof(HLDB[0]); j++) {
+    for (k = 0; HLDB[j].filematch[k]; k++) {
+      const char *match = HLDB[j].filematch[k];
+      if ((match[0] == '.' && ext && strcmp(ext, match) == 0) ||
+          (match[0] != '.' && strstr(ECONFIG.filename, match))) {
+        ECONFIG.syntax = &HLDB[j];
+        return;
+      }
+    }
   }
-  ECONFIG.cy++;
-  ECONFIG.cx = 0;
 }
 
-void editorDelChar() {
-  if (ECONFIG.cy == ECONFIG.numrows) return;
-  if (ECONFIG.cx == 0 && ECONFIG.cy == 0) return;
+void editorHighlightRow(editorRow *row, int state) {
+  row->hl = realloc(row->hl, row->rsize + 1);
+  row->hl_in = state;
+  row->hl_out = lexRow(ECONFIG.syntax->lexer, row, state);
+  row->hl_version = row->version;
+}
 
-  editorRow *row = &ECONFIG.row[ECONFIG.cy];
-  if (ECONFIG.cx > 0) {
-    editorRowDelChar(row, ECONFIG.cx - 1);
-    ECONFIG.cx--;
-  }
-  else {
-    ECONFIG.cx = ECONFIG.row[ECONFIG.cy - 1].size;
-    editorRowAppendString(&ECONFIG.row[ECONFIG.cy - 1], row->chars, row->size);
-    editorDelRow(ECONFIG.cy);
-    ECONFIG.cy--;
-  }
+void hlFreeSlot(struct hlSlot *slot) {
+  if (slot == NULL) return;
+  free(slot->hl);
+  free(slot);
 }
 
-char *editorRowsToString(int *buflen) {
-  int totlen = 0;
-  int j;
-  for (j = 0; j < ECONFIG.numrows; j++) {
-    totlen += ECONFIG.row[j].size + 1;
-  }
-  *buflen = totlen;
+/* Lex rows from..to in order into fresh slots, a slice at a time so hlStop() never waits long */
+void *hlWorker(void *arg) {
+  struct editorHighlighter *h = arg;
+  int cond = h->state;
+  int j, at;
 
-  char *buf = malloc(totlen);
-  char *p = buf;
-  for (j = 0; j < ECONFIG.numrows; j++) {
-    memcpy(p, ECONFIG.row[j].chars, ECONFIG.row[j].size);
-    p += ECONFIG.row[j].size;
-    *p = '\n';
-    p++;
-  }
+  for (j = h->from; j <= h->to; j++) {
+    editorRow *row = &ECONFIG.row[j];
+    struct hlSlot *slot = malloc(sizeof(struct hlSlot));
+    slot->hl = malloc(row->rsize + 1);
+    slot->version = row->version;
+    slot->in = cond;
 
-  return buf;
+    unsigned state = h->lexer->start[cond];
+    int start = 0;
+    for (at = 0; at < row->rsize && !__atomic_load_n(&h->cancel, __ATOMIC_RELAXED); at += EDITOR_HL_SLICE) {
+      int end = row->rsize - at < EDITOR_HL_SLICE ? row->rsize : at + EDITOR_HL_SLICE;
+      state = lexRun(h->lexer, (const unsigned char *) row->render, slot->hl, at, end, state, &start);
+    }
+    if (at < row->rsize) {
+      hlFreeSlot(slot);
+      break;
+    }
+    cond = slot->out = lexCondition(h->lexer, state);
+    hlFreeSlot(__atomic_exchange_n(&row->hlslot, slot, __ATOMIC_ACQ_REL));
+    __atomic_store_n(&h->published, 1, __ATOMIC_RELEASE);
+  }
+  __atomic_store_n(&h->running, 0, __ATOMIC_RELEASE);
+  return NULL;
 }
 
-void editorOpen(char *filename) {
-  free(ECONFIG.filename);
-  ECONFIG.filename = strdup(filename);
-
-  FILE *fp = fopen(filename, "r");
-  if (!fp) die("fopen");
+void hlStop() {
+  struct editorHighlighter *h = &ECONFIG.highlighter;
+  if (!h->started) return;
+  __atomic_store_n(&h->cancel, 1, __ATOMIC_RELAXED);
+  pthread_join(h->thread, NULL);
+  h->started = 0;
+}
 
-  char *line = NULL;
-  size_t linecap = 0;
-  ssize_t linelen;
-  while ((linelen = getline(&line, &linecap, fp)) != -1) {
-    while (linelen > 0 && (line[linelen - 1] == '\n' || line[linelen -1] == '\r')) {
-      linelen--;
-    }
+void hlStart(int from, int state, int to) {
+  struct editorHighlighter *h = &ECONFIG.highlighter;
+  h->from = from;
+  h->to = to;
+  h->state = state;
+  h->lexer = ECONFIG.syntax->lexer;
+  h->cancel = 0;
+  h->running = 1;
+  h->started = pthread_create(&h->thread, NULL, hlWorker, h) == 0;
+}
 
-    editorInsertRow(ECONFIG.numrows, line, linelen);
-  }
-  free(line);
-  fclose(fp);
-  ECONFIG.dirty = 0;
+/* Returns 1 if the background highlighter has something new to show */
+int hlPoll() {
+  struct editorHighlighter *h = &ECONFIG.highlighter;
+  if (h->started && __atomic_load_n(&h->running, __ATOMIC_ACQUIRE) == 0) hlStop();
+  return __atomic_exchange_n(&h->published, 0, __ATOMIC_ACQ_REL);
 }
 
-void editorSave() {
-  if (ECONFIG.filename == NULL) {
-    ECONFIG.filename = editorPrompt("Save as: %s (ESC to cancel)");
-    if (ECONFIG.filename == NULL) {
-      editorSetStatusMessage("Save aborted");
-      return;
+/*
+ * Bring rows up to `last` up to date, relexing only rows whose text or start state changed.
+ * Rows are lexed here until EDITOR_HL_BUDGET bytes are spent; from there on the background
+ * highlighter takes over and its slots are adopted once they match the row's version and
+ * start state. Until then such rows are drawn with whatever they have.
+ */
+void editorHighlightRows(int last) {
+  struct editorHighlighter *h = &ECONFIG.highlighter;
+  if (ECONFIG.syntax == NULL) return;
+  if (last >= ECONFIG.numrows) last = ECONFIG.numrows - 1;
+  if (h->started && __atomic_load_n(&h->running, __ATOMIC_ACQUIRE) == 0) hlStop();
+
+  int budget = EDITOR_HL_BUDGET;
+  int j, state = 0;
+  for (j = ECONFIG.hlfrom; j <= last; j++) {
+    editorRow *row = &ECONFIG.row[j];
+    state = j > 0 ? ECONFIG.row[j - 1].hl_out : 0;
+    if (__atomic_load_n(&row->hlslot, __ATOMIC_RELAXED)) {
+      struct hlSlot *slot = __atomic_exchange_n(&row->hlslot, NULL, __ATOMIC_ACQ_REL);
+      if (slot->version == row->version && slot->in == state) {
+        unsigned char *hl = row->hl;
+        row->hl = slot->hl;
+        slot->hl = hl;
+        row->hl_in = slot->in;
+        row->hl_out = slot->out;
+        row->hl_version = slot->version;
+      }
+      hlFreeSlot(slot);
     }
+    if (row->hl_version == row->version && row->hl_in == state) continue;
+    if (row->rsize > budget) break;
+    budget -= row->rsize;
+    editorHighlightRow(row, state);
   }
+  if (j > ECONFIG.hlfrom) ECONFIG.hlfrom = j;
 
-  int len;
-  char *buf = editorRowsToString(&len);
+  if (j <= last && !h->started) {
+    int to = last + EDITOR_HL_AHEAD < ECONFIG.numrows ? last + EDITOR_HL_AHEAD : ECONFIG.numrows - 1;
+    hlStart(j, state, to);
+  }
+}
 
-  int fd = open(ECONFIG.filename, O_RDWR | O_CREAT, 0644);
-  if (fd != -1) {
-    if (ftruncate(fd, len) != -1) {
-      if (write(fd, buf, len) == len) {
-        close(fd);
-        free(buf);
-        ECONFIG.dirty = 0;
-        editorSetStatusMessage("%d bytes written to disk", len);
-        return;
-      }
-    }
-    close(fd);
+const char *editorHighlightEscape(int hl) {
+  switch (hl) {
+    case HL_COMMENT: return "\x1b[0;36m";
+    case HL_KEYWORD1: return "\x1b[0;33m";
+    case HL_KEYWORD2: return "\x1b[0;32m";
+    case HL_STRING: return "\x1b[0;35m";
+    case HL_NUMBER: return "\x1b[0;31m";
+    case HL_MATCH: return "\x1b[0;30;43m";
+    default: return "\x1b[m";
   }
-  
-  free(buf);
-  editorSetStatusMessage("Can save! I/O error: %s", strerror(errno));
 }
 
 struct appendbuffer {
@@ -416,11 +6509,27 @@ void editorScroll() {
     ECONFIG.rx = editorRowCxToRx(&ECONFIG.row[ECONFIG.cy], ECONFIG.cx);
   }
 
+  if (editorFoldsActive()) {
+    editorRevealRow(ECONFIG.cy); /* find, undo and bracket jumps can land in a fold */
+    ECONFIG.rowoffset = editorRowAfter(ECONFIG.rowoffset, 0);
+  }
+  if (ECONFIG.wrap) {
+    if (ECONFIG.wrapcols != ECONFIG.screencols) rowIndexRewrap();
+    int seg = 0, start;
+    if (ECONFIG.cy < ECONFIG.numrows) seg = editorWrapSegment(&ECONFIG.row[ECONFIG.cy], ECONFIG.rx, &start);
+    int top = editorLineOf(ECONFIG.rowoffset) + ECONFIG.segoffset;
+    int line = editorLineOf(ECONFIG.cy) + seg;
+    if (line < top) top = line;
+    if (line >= top + ECONFIG.screenrows) top = line - ECONFIG.screenrows + 1;
+    ECONFIG.rowoffset = editorLineRow(top, &ECONFIG.segoffset);
+    ECONFIG.coloffset = 0;
+    return;
+  }
   if (ECONFIG.cy < ECONFIG.rowoffset) {
     ECONFIG.rowoffset = ECONFIG.cy;
   }
-  if (ECONFIG.cy >= ECONFIG.rowoffset + ECONFIG.screenrows) {
-    ECONFIG.rowoffset = ECONFIG.cy - ECONFIG.screenrows + 1;
+  if (editorRowsBetween(ECONFIG.rowoffset, ECONFIG.cy) >= ECONFIG.screenrows) {
+    ECONFIG.rowoffset = editorRowAfter(ECONFIG.cy, -(ECONFIG.screenrows - 1));
   }
   if (ECONFIG.rx < ECONFIG.coloffset) {
     ECONFIG.coloffset = ECONFIG.rx;
@@ -430,12 +6539,140 @@ void editorScroll() {
   }
 }
 
+/*
+ * Screen lines are only sent to the terminal again when what they show changed. Each
+ * line keeps the version of the row it showed, where in the row it started, the lexer
+ * state its colors came from and its fold marker; settings that shape every line are
+ * kept once. Comparing those to the current ones is enough, as colors and matches are
+ * a function of them, so typing on one line redraws that line and the bars. Lines set
+ * in the dirty bitmap are drawn regardless, after the viewer or the compare view drew
+ * over the screen, or on Ctrl-L.
+ */
+
+/* Draw every screen line again on the next refresh */
+void editorScreenInvalidate() {
+  struct editorScreen *s = &ECONFIG.screen;
+  if (s->dirty) memset(s->dirty, 0xff, sizeof(uint64_t) * ((s->rows + 63) / 64));
+}
+
+/* Get the tracking ready for a frame, everything is dirty if the settings changed */
+void editorScreenBegin() {
+  struct editorScreen *s = &ECONFIG.screen;
+  if (s->rows != ECONFIG.screenrows) {
+    s->rows = ECONFIG.screenrows;
+    s->line = realloc(s->line, sizeof(*s->line) * s->rows);
+    s->dirty = realloc(s->dirty, sizeof(uint64_t) * ((s->rows + 63) / 64));
+    editorScreenInvalidate();
+  }
+  int highlight = ECONFIG.find.highlight;
+  if (s->coloffset != ECONFIG.coloffset || s->cols != ECONFIG.screencols || s->wrap != ECONFIG.wrap ||
+    s->highlight != highlight || (highlight && s->query != ECONFIG.find.query) || s->syntax != ECONFIG.syntax) {
+    s->coloffset = ECONFIG.coloffset;
+    s->cols = ECONFIG.screencols;
+    s->wrap = ECONFIG.wrap;
+    s->highlight = highlight;
+    s->query = ECONFIG.find.query;
+    s->syntax = ECONFIG.syntax;
+    editorScreenInvalidate();
+  }
+}
+
+/* Whether screen line y has to be drawn to show `now`, which it is then taken to show */
+int editorScreenLineChanged(int y, const struct screenLine *now) {
+  struct screenLine *was = &ECONFIG.screen.line[y];
+  uint64_t *word = &ECONFIG.screen.dirty[y / 64], bit = 1ULL << (y % 64);
+  int changed = (*word & bit) || was->version != now->version || was->at != now->at ||
+    was->hl != now->hl || was->hidden != now->hidden;
+  *word &= ~bit;
+  *was = *now;
+  return changed;
+}
+
+/* Draw render bytes [at, end) of row after pad blank columns, then its fold marker */
+void drawRow(struct appendbuffer *ab, editorRow *row, int at, int end, int pad, int hidden) {
+  int len = pad + editorRenderColumn(row, end) - editorRenderColumn(row, at);
+  while (pad-- > 0) aBufferAppend(ab, " ", 1);
+  struct rowMatches *rm = ECONFIG.find.highlight && len > 0 ? editorRowMatches(row) : NULL;
+  unsigned char *hl = ECONFIG.syntax && row->hl_version == row->version ? row->hl : NULL;
+  int k = 0, current = HL_NORMAL;
+
+  /* emit runs of one class, find matches drawn over the syntax colors */
+  while (at < end) {
+    while (rm && k < rm->count && rm->span[k * 2 + 1] <= at) k++;
+    int match = rm && k < rm->count && rm->span[k * 2] <= at;
+    int stop = end;
+    if (rm && k < rm->count && rm->span[k * 2 + match] < stop) stop = rm->span[k * 2 + match];
+    int cls = match ? HL_MATCH : hl ? hl[at] : HL_NORMAL;
+    int run = at + 1;
+    while (run < stop && (match || hl == NULL || hl[run] == cls)) run++;
+    if (cls != current) {
+      const char *esc = editorHighlightEscape(cls);
+      aBufferAppend(ab, esc, strlen(esc));
+      current = cls;
+    }
+    aBufferAppend(ab, &row->render[at], run - at);
+    at = run;
+  }
+  if (current != HL_NORMAL) aBufferAppend(ab, "\x1b[m", 3);
+
+  if (hidden) {
+    char marker[32];
+    int mlen = snprintf(marker, sizeof(marker), " +%d lines ", hidden);
+    if (mlen > ECONFIG.screencols - len) mlen = ECONFIG.screencols - len;
+    aBufferAppend(ab, "\x1b[7m", 4);
+    aBufferAppend(ab, marker, mlen);
+    aBufferAppend(ab, "\x1b[m", 3);
+  }
+}
+
 void drawRows(struct appendbuffer *ab) {
-  int y;
+  int y, k, filerow = ECONFIG.rowoffset, from = 0, folds = editorFoldsActive();
+  if (ECONFIG.view.active) {
+    viewDrawRows(ab);
+    editorScreenInvalidate();
+    return;
+  }
+  if (ECONFIG.compare.active) {
+    compareDrawRows(ab);
+    editorScreenInvalidate();
+    return;
+  }
+  editorHighlightRows(editorRowAfter(ECONFIG.rowoffset, ECONFIG.screenrows + EDITOR_HL_LOOKAHEAD));
+  editorScreenBegin();
+  if (ECONFIG.wrap && filerow < ECONFIG.numrows) {
+    for (k = 0; k < ECONFIG.segoffset; k++) from = editorWrapEnd(&ECONFIG.row[filerow], from);
+  }
   for (y = 0; y < ECONFIG.screenrows; y++) {
-    int filerow = y + ECONFIG.rowoffset;
+    struct screenLine now = {0, 0, 0, 0};
+    editorRow *row = NULL;
+    int at = 0, end = 0, pad = 0;
     if (filerow >= ECONFIG.numrows) {
-      if (ECONFIG.numrows == 0 && y == ECONFIG.screenrows /3) {
+      if (ECONFIG.numrows == 0 && y == ECONFIG.screenrows / 3) now.at = -1;
+    }
+    else {
+      row = &ECONFIG.row[filerow];
+      if (ECONFIG.wrap) {
+        at = from;
+        end = editorWrapEnd(row, from);
+        from = end < row->rsize ? end : 0;
+      }
+      else {
+        /* a wide character cut by the left edge leaves blank columns */
+        at = editorRenderAt(row, ECONFIG.coloffset);
+        if (at < row->rsize) pad = editorRenderColumn(row, at) - ECONFIG.coloffset;
+        end = editorRenderFit(row, at, ECONFIG.screencols - pad);
+      }
+      now.version = row->version;
+      now.at = at;
+      now.hl = ECONFIG.syntax && row->hl_version == row->version ? row->hl_in + 1 : 0;
+      now.hidden = folds && from == 0 ? rowIndexFoldLen(filerow) : 0;
+    }
+
+    if (editorScreenLineChanged(y, &now)) {
+      if (row) {
+        drawRow(ab, row, at, end, pad, now.hidden);
+      }
+      else if (now.at == -1) {
         char welcome[80];
         int welcomelen = snprintf(welcome, sizeof(welcome),
           "Editor -- version %s", EDITOR_VERSION);
@@ -451,16 +6688,10 @@ void drawRows(struct appendbuffer *ab) {
       else {
         aBufferAppend(ab, "~", 1);
       }
+      aBufferAppend(ab, "\x1b[K", 3);
     }
-    else {
-      int len = ECONFIG.row[filerow].rsize - ECONFIG.coloffset;
-      if (len < 0) len = 0;
-      if (len > ECONFIG.screencols) len = ECONFIG.screencols;
-      aBufferAppend(ab, &ECONFIG.row[filerow].render[ECONFIG.coloffset], len);
-    }
-    
-    aBufferAppend(ab, "\x1b[K", 3);
     aBufferAppend(ab, "\r\n", 2);
+    if (from == 0) filerow = editorNextRow(filerow);
   }
 }
 
@@ -470,8 +6701,26 @@ void drawStatusBar(struct appendbuffer *ab) {
   int len = snprintf(status, sizeof(status), "%.20s - %d lines %s",
     ECONFIG.filename ? ECONFIG.filename : "[No Name]", ECONFIG.numrows,
     ECONFIG.dirty ? "(modified)" : "");
-  int rlen = snprintf(rstatus, sizeof(rstatus), "%d / %d",
-    ECONFIG.cy + 1, ECONFIG.numrows);
+  const char *filetype = ECONFIG.syntax ? ECONFIG.syntax->filetype : "no ft";
+  int rlen;
+  if (ECONFIG.view.active) {
+    len = snprintf(status, sizeof(status), "%.20s - %.1f MB (read-only%s)", ECONFIG.filename,
+      ECONFIG.view.size / 1e6, ECONFIG.view.follow ? ", following" : "");
+    rlen = viewPosition(rstatus, sizeof(rstatus));
+  }
+  else if (ECONFIG.compare.active) {
+    struct editorCompare *cmp = &ECONFIG.compare;
+    len = snprintf(status, sizeof(status), "%.20s vs %.20s", ECONFIG.filename ? ECONFIG.filename : "[No Name]", cmp->path);
+    rlen = snprintf(rstatus, sizeof(rstatus), "+%d -%d in %d change%s | %d%%", cmp->added, cmp->removed, cmp->hunks,
+      cmp->hunks == 1 ? "" : "s", cmp->numshown > 0 ? (int) (cmp->top * 100LL / cmp->numshown) : 100);
+  }
+  else if (ECONFIG.search.query) {
+    rlen = snprintf(rstatus, sizeof(rstatus), "%zu matches%s | %s | %d / %d",
+      ECONFIG.search.nmatches, ECONFIG.search.done ? "" : "...", filetype, ECONFIG.cy + 1, ECONFIG.numrows);
+  }
+  else {
+    rlen = snprintf(rstatus, sizeof(rstatus), "%s | %d / %d", filetype, ECONFIG.cy + 1, ECONFIG.numrows);
+  }
   if (len > ECONFIG.screencols) len = ECONFIG.screencols;
   aBufferAppend(ab, status, len);
   while (len < ECONFIG.screencols) {
@@ -498,6 +6747,7 @@ void drawMessageBar(struct appendbuffer *ab) {
 }
 
 void refreshScreen() {
+  searchPoll();
   editorScroll();
 
   struct appendbuffer ab = APPENDBUFFER_INIT;
@@ -508,11 +6758,18 @@ void refreshScreen() {
   drawStatusBar(&ab);
   drawMessageBar(&ab);
 
+  int cursory = editorRowsBetween(ECONFIG.rowoffset, ECONFIG.cy) - ECONFIG.segoffset;
+  int cursorx = ECONFIG.rx - ECONFIG.coloffset;
+  if (ECONFIG.wrap && ECONFIG.cy < ECONFIG.numrows) {
+    int start;
+    cursory += editorWrapSegment(&ECONFIG.row[ECONFIG.cy], ECONFIG.rx, &start);
+    cursorx = ECONFIG.rx - start;
+  }
+
   char buf[32];
-  snprintf(buf, sizeof(buf), "\x1b[%d;%dH", (ECONFIG.cy - ECONFIG.rowoffset) + 1,
-                        (ECONFIG.rx - ECONFIG.coloffset) + 1);
+  snprintf(buf, sizeof(buf), "\x1b[%d;%dH", cursory + 1, cursorx + 1);
   aBufferAppend(&ab, buf, strlen(buf)); /* position cursor back at top left */
-  aBufferAppend(&ab, "\x1b[?25h", 6); /* show cursor */
+  if (!ECONFIG.compare.active) aBufferAppend(&ab, "\x1b[?25h", 6); /* show cursor, the compare view has none */
   
   write(STDOUT_FILENO, ab.b, ab.len);
   aBufferFree(&ab);
@@ -526,7 +6783,7 @@ void editorSetStatusMessage(const char *fmt, ...) {
   ECONFIG.statusmsg_time = time(NULL);
 }
 
-char *editorPrompt(char *prompt) {
+char *editorPrompt(char *prompt, void (*callback)(char *, int)) {
   size_t bufsize = 128;
   char *buf = malloc(bufsize);
   
@@ -539,20 +6796,23 @@ char *editorPrompt(char *prompt) {
     
     int c = readKey();
     if (c == DEL_KEY || c == CTRL_KEY('h') || c == BACKSPACE) {
+      while (buflen > 1 && (buf[buflen - 1] & 0xC0) == 0x80) buflen--;
       if (buflen != 0) buf[--buflen] = '\0';
     }
     else if (c == '\x1b') {
       editorSetStatusMessage("");
+      if (callback) callback(buf, c);
       free(buf);
       return NULL;
     }
     else if (c == '\r') {
       if (buflen != 0) {
         editorSetStatusMessage("");
+        if (callback) callback(buf, c);
         return buf;
       }
     }
-    else if (!iscntrl(c) && c < 128) {
+    else if (!iscntrl(c) && c < 256) {
       if (buflen == bufsize - 1) {
         bufsize *= 2;
         buf = realloc(buf, bufsize);
@@ -560,6 +6820,26 @@ char *editorPrompt(char *prompt) {
       buf[buflen++] = c;
       buf[buflen] = '\0';
     }
+
+    if (callback) callback(buf, c);
+  }
+}
+
+/* Ask a yes/no question on the message bar */
+int editorConfirm(const char *msg) {
+  while (1) {
+    editorSetStatusMessage("%s", msg);
+    refreshScreen();
+
+    int c = readKey();
+    if (c == 'y' || c == 'Y') {
+      editorSetStatusMessage("");
+      return 1;
+    }
+    if (c == 'n' || c == 'N' || c == '\x1b') {
+      editorSetStatusMessage("");
+      return 0;
+    }
   }
 }
 
@@ -569,30 +6849,36 @@ void moveCursor(int key) {
   switch (key) {
     case ARROW_LEFT:
       if (ECONFIG.cx != 0) {
-        ECONFIG.cx--;
+        ECONFIG.cx = editorRowPrevChar(row, ECONFIG.cx);
       }
       else if (ECONFIG.cy > 0) {
-        ECONFIG.cy--;
+        ECONFIG.cy = editorRowAfter(ECONFIG.cy, -1);
         ECONFIG.cx = ECONFIG.row[ECONFIG.cy].size;
       }
       break;
     case ARROW_RIGHT:
       if (row && ECONFIG.cx < row->size) {
-        ECONFIG.cx++;
+        ECONFIG.cx = editorRowNextChar(row, ECONFIG.cx);
       }
       else if (row && ECONFIG.cx == row->size) {
-        ECONFIG.cy++;
+        ECONFIG.cy = editorNextRow(ECONFIG.cy);
         ECONFIG.cx = 0;
       }
       break;
     case ARROW_UP:
-      if (ECONFIG.cy != 0) {
-        ECONFIG.cy--;
+      if (ECONFIG.wrap) {
+        editorMoveLine(-1);
+      }
+      else if (ECONFIG.cy != 0) {
+        ECONFIG.cy = editorRowAfter(ECONFIG.cy, -1);
       }
       break;
     case ARROW_DOWN:
-      if (ECONFIG.cy < ECONFIG.numrows) {
-        ECONFIG.cy++;
+      if (ECONFIG.wrap) {
+        editorMoveLine(1);
+      }
+      else if (ECONFIG.cy < ECONFIG.numrows) {
+        ECONFIG.cy = editorNextRow(ECONFIG.cy);
       }
       break;
   }
@@ -602,12 +6888,21 @@ void moveCursor(int key) {
   if (ECONFIG.cx > rowlen) {
     ECONFIG.cx = rowlen;
   }
+  /* not into the middle of a UTF-8 sequence */
+  while (row && !row->ascii && ECONFIG.cx > 0 && ECONFIG.cx < rowlen && (row->chars[ECONFIG.cx] & 0xC0) == 0x80) {
+    ECONFIG.cx--;
+  }
 }
 
 void processKeypress() {
   static int quit_times = EDITOR_QUIT_TIMES;
 
   int c = readKey();
+  if (ECONFIG.view.active && viewProcessKey(c)) return;
+  if (ECONFIG.compare.active) {
+    compareProcessKey(c);
+    return;
+  }
 
   switch (c) {
     case '\r':
@@ -623,18 +6918,68 @@ void processKeypress() {
       }
       write(STDOUT_FILENO, "\x1b[2J", 4); /* clear the screen */
       write(STDOUT_FILENO, "\x1b[H", 3); /* position cursor at top left */
+      journalDiscard();
       exit(0);
       break;
 
     case CTRL_KEY('s'):
+      undoBreak();
       editorSave();
       break;
 
+    case CTRL_KEY('f'):
+      undoBreak();
+      editorFind();
+      break;
+
+    case CTRL_KEY('r'):
+      editorReplace();
+      break;
+
+    case CTRL_KEY('z'):
+      editorUndo();
+      break;
+
+    case CTRL_KEY('b'):
+      editorMatchBracket();
+      break;
+
+    case CTRL_KEY('t'):
+      editorToggleFold();
+      break;
+
+    case CTRL_KEY('w'):
+      editorToggleWrap();
+      break;
+
+    case CTRL_KEY('y'):
+      editorRedo();
+      break;
+
+    case CTRL_KEY('o'):
+      if (ECONFIG.filename && ECONFIG.disk_size >= 0) {
+        int rows = editorReload();
+        if (rows >= 0) editorSetStatusMessage("Reloaded, %d rows differed from the file", rows);
+      }
+      break;
+
+    case CTRL_KEY('d'):
+      undoBreak();
+      if (ECONFIG.filename) compareOpen(ECONFIG.filename);
+      else comparePrompt();
+      break;
+
+    case PASTE_START:
+      editorPaste();
+      break;
+
     case HOME_KEY:
+      undoBreak();
       ECONFIG.cx = 0;
       break;
 
     case END_KEY:
+      undoBreak();
       if (ECONFIG.cy < ECONFIG.numrows) {
         ECONFIG.cx = ECONFIG.row[ECONFIG.cy].size;
       }
@@ -650,12 +6995,12 @@ void processKeypress() {
     case PAGE_UP:
     case PAGE_DOWN:
     {
+      undoBreak();
       if (c == PAGE_UP) {
         ECONFIG.cy = ECONFIG.rowoffset;
       }
       else if (c == PAGE_DOWN) {
-        ECONFIG.cy = ECONFIG.rowoffset + ECONFIG.screenrows - 1;
-        if (ECONFIG.cy > ECONFIG.numrows) ECONFIG.cy = ECONFIG.numrows;
+        ECONFIG.cy = editorRowAfter(ECONFIG.rowoffset, ECONFIG.screenrows - 1);
       }
 
       int times = ECONFIG.screenrows;
@@ -668,11 +7013,16 @@ void processKeypress() {
     case ARROW_DOWN:
     case ARROW_LEFT:
     case ARROW_RIGHT:
+      undoBreak();
       moveCursor(c);
       break;
 
     case CTRL_KEY('l'):
+      editorScreenInvalidate();
+      break;
+
     case '\x1b':
+    case PASTE_END:
       break;
     
     default:
@@ -688,13 +7038,29 @@ void initEditor() {
   ECONFIG.cy = 0;
   ECONFIG.rx = 0;
   ECONFIG.rowoffset = 0;
+  ECONFIG.segoffset = 0;
   ECONFIG.coloffset = 0;
   ECONFIG.numrows = 0;
   ECONFIG.row = NULL;
   ECONFIG.dirty = 0;
+  ECONFIG.savefrom = 0;
+  ECONFIG.disk_size = -1;
+  ECONFIG.diskwatch = -1;
   ECONFIG.filename = NULL;
+  ECONFIG.syntax = NULL;
+  ECONFIG.hlfrom = 0;
   ECONFIG.statusmsg[0] = '\0';
   ECONFIG.statusmsg_time = 0;
+  memset(&ECONFIG.journal, 0, sizeof(ECONFIG.journal));
+  ECONFIG.journal.fd = -1;
+  memset(&ECONFIG.undo, 0, sizeof(ECONFIG.undo));
+  memset(&ECONFIG.search, 0, sizeof(ECONFIG.search));
+  pthread_mutex_init(&ECONFIG.search.lock, NULL);
+  char *limit = getenv("FLY_UNDO_LIMIT");
+  ECONFIG.undo.limit = limit ? strtoull(limit, NULL, 10) : EDITOR_UNDO_LIMIT;
+  memset(&ECONFIG.view, 0, sizeof(ECONFIG.view));
+  char *budget = getenv("FLY_VIEW_MEMORY");
+  ECONFIG.view.budget = budget ? strtoull(budget, NULL, 10) : EDITOR_VIEW_MEMORY;
 
   if (getWindowSize(&ECONFIG.screenrows, &ECONFIG.screencols) == -1) die("getWindowSize");
   ECONFIG.screenrows -= 2;
@@ -703,11 +7069,19 @@ void initEditor() {
 int main(int argc, char *argv[]) {
   initTermios();
   initEditor();
-  if (argc >= 2) {
+  signal(SIGHUP, journalSignalHandler);
+  signal(SIGTERM, journalSignalHandler);
+  if (argc >= 3 && (strcmp(argv[1], "-R") == 0 || strcmp(argv[1], "-F") == 0)) {
+    viewOpen(argv[2]);
+    if (argv[1][1] == 'F') viewFollow(1);
+  }
+  else if (argc >= 2) {
     editorOpen(argv[1]);
   }
 
-  editorSetStatusMessage("HELP: Ctrl-S = save | Ctrl-Q = quit");
+  if (ECONFIG.statusmsg[0] == '\0') {
+    editorSetStatusMessage("HELP: Ctrl-S = save | Ctrl-Q = quit | Ctrl-F = find | Ctrl-Z/Ctrl-Y = undo/redo");
+  }
 
   while (1) {
     refreshScreen();
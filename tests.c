@@ -0,0 +1,532 @@
+/*
+ * Correctness checks for the editor internals. Build and run them all with `make test`,
+ * or one with `./tests <name>`. Exits non-zero when any check fails.
+ */
+#define main editorMain
+#include "main.c"
+#undef main
+
+#include <sys/resource.h>
+
+int testFailures;
+
+/* Count a failed check, only the first few are printed */
+void testFail(const char *fmt, ...) {
+  va_list ap;
+  if (testFailures++ >= 10) return;
+  va_start(ap, fmt);
+  vprintf(fmt, ap);
+  va_end(ap);
+  printf("\n");
+}
+
+unsigned testSeed = 11;
+
+unsigned testRandom() {
+  testSeed = testSeed * 1103515245 + 12345;
+  return testSeed >> 8;
+}
+
+/* Drop the current buffer so the next editorOpen starts from scratch */
+void testResetEditor() {
+  int j;
+  hlStop(); /* it reads the rows */
+  for (j = 0; j < ECONFIG.numrows; j++) editorFreeRow(&ECONFIG.row[j]);
+  free(ECONFIG.row);
+  free(ECONFIG.filename);
+  free(ECONFIG.undo.buf);
+  if (ECONFIG.journal.fd != -1) close(ECONFIG.journal.fd);
+  free(ECONFIG.journal.path);
+  free(ECONFIG.journal.buf);
+  searchClear();
+  free(ECONFIG.search.matches);
+  free(ECONFIG.search.pending);
+  trigramDiscard();
+  rowIndexDiscard();
+  viewClose();
+  compareClose();
+  if (ECONFIG.diskwatch > 0) close(ECONFIG.diskwatch);
+  free(ECONFIG.screen.line);
+  free(ECONFIG.screen.dirty);
+  memset(&ECONFIG, 0, sizeof(ECONFIG));
+  pthread_mutex_init(&ECONFIG.search.lock, NULL);
+  ECONFIG.disk_size = -1;
+  ECONFIG.journal.fd = -1;
+  ECONFIG.diskwatch = -1;
+  ECONFIG.undo.limit = EDITOR_UNDO_LIMIT;
+  ECONFIG.screenrows = 24;
+  ECONFIG.screencols = 80;
+}
+
+/* Remove a test file along with the sidecars the editor left next to it */
+void testUnlink(const char *path) {
+  const char *suffix[] = {"fjournal", "fundo", "ftrigram"};
+  unsigned int j;
+  unlink(path);
+  for (j = 0; j < sizeof(suffix) / sizeof(suffix[0]); j++) {
+    char *sidecar = editorSidecarPath(path, suffix[j]);
+    unlink(sidecar);
+    free(sidecar);
+  }
+}
+
+void testWriteFile(const char *path, const char *s, size_t len) {
+  FILE *fp = fopen(path, "w");
+  if (!fp) die("fopen");
+  fwrite(s, 1, len, fp);
+  fclose(fp);
+}
+
+char *testReadFile(const char *path, size_t *len) {
+  FILE *fp = fopen(path, "r");
+  if (!fp) die("fopen");
+  fseek(fp, 0, SEEK_END);
+  long size = ftell(fp);
+  rewind(fp);
+  char *s = malloc(size + 1);
+  *len = fread(s, 1, size, fp);
+  fclose(fp);
+  return s;
+}
+
+/* The buffer as text, every row followed by a '\n' */
+char *testSnapshot(size_t *len) {
+  size_t n = 0;
+  int j;
+  for (j = 0; j < ECONFIG.numrows; j++) n += ECONFIG.row[j].size + 1;
+  char *s = malloc(n + 1), *p = s;
+  for (j = 0; j < ECONFIG.numrows; j++) {
+    memcpy(p, ECONFIG.row[j].chars, ECONFIG.row[j].size);
+    p += ECONFIG.row[j].size;
+    *p++ = '\n';
+  }
+  *len = n;
+  return s;
+}
+
+/* What testSnapshot() should return after opening a file holding s: no '\r', every line ends in '\n' */
+char *testNormalize(const char *s, size_t len, size_t *outlen) {
+  char *out = malloc(len + 2);
+  size_t n = 0, i = 0;
+  while (i < len) {
+    const char *nl = memchr(s + i, '\n', len - i);
+    size_t e = nl ? (size_t) (nl - s) : len, k = e;
+    while (k > i && s[k - 1] == '\r') k--;
+    memcpy(out + n, s + i, k - i);
+    n += k - i;
+    out[n++] = '\n';
+    i = nl ? e + 1 : len;
+  }
+  *outlen = n;
+  return out;
+}
+
+int testSame(const char *a, size_t alen, const char *b, size_t blen) {
+  return alen == blen && memcmp(a, b, alen) == 0;
+}
+
+/* A few short lines from a small alphabet, some with '\r\n', maybe without a final newline */
+char *testGenerateLines(int lines, size_t *len) {
+  char *s = malloc(lines * 8 + 16);
+  size_t n = 0;
+  int j;
+  for (j = 0; j < lines; j++) {
+    n += sprintf(s + n, "l%u", testRandom() % 6);
+    if (testRandom() % 10 == 0) s[n++] = '\r';
+    s[n++] = '\n';
+  }
+  if (lines && testRandom() % 4 == 0) n--;
+  *len = n;
+  return s;
+}
+
+/* Drop, change and insert random lines of src the way another program editing it would */
+char *testMutate(const char *src, size_t len, size_t *outlen) {
+  char *s = malloc(len * 3 + 200);
+  size_t n = 0, i = 0;
+  while (i < len) {
+    const char *nl = memchr(src + i, '\n', len - i);
+    size_t e = nl ? (size_t) (nl - src) + 1 : len;
+    switch (testRandom() % 20) {
+      case 0:
+        break;
+      case 1:
+        n += sprintf(s + n, "new%u\n", testRandom() % 5);
+        memcpy(s + n, src + i, e - i);
+        n += e - i;
+        break;
+      case 2:
+        n += sprintf(s + n, "chg%u\n", testRandom() % 5);
+        break;
+      default:
+        memcpy(s + n, src + i, e - i);
+        n += e - i;
+    }
+    i = e;
+  }
+  if (testRandom() % 3 == 0) n += sprintf(s + n, "tail%u\n", testRandom() % 3);
+  *outlen = n;
+  return s;
+}
+
+/* The row index kept up to date by the reload matches one built from scratch */
+void testCheckRowIndex(int round) {
+  struct rowNode kept = ECONFIG.rowindex.nodes[ECONFIG.rowindex.root];
+  rowIndexDiscard();
+  rowIndexBuild();
+  struct rowNode fresh = ECONFIG.rowindex.nodes[ECONFIG.rowindex.root];
+  if (kept.size != ECONFIG.numrows || kept.size != fresh.size || kept.sumdelta != fresh.sumdelta ||
+    kept.mindip != fresh.mindip || kept.minindent != fresh.minindent) {
+    testFail("round %d: row index out of date after reload (%d rows, %d indexed)", round, ECONFIG.numrows, kept.size);
+  }
+}
+
+/* Reload random changes made on disk, then save, undo and redo the reload */
+void testReload(int argc, char **argv) {
+  int rounds = argc > 0 ? atoi(argv[0]) : 300;
+  const char *path = "test_reload.tmp";
+  int round;
+
+  for (round = 0; round < rounds; round++) {
+    size_t oldlen, newlen, wantlen, len, beforelen;
+    char *old = testGenerateLines(testRandom() % 12, &oldlen);
+    testResetEditor();
+    testWriteFile(path, old, oldlen);
+    editorOpen((char *) path);
+    if (round % 2) rowIndexBuild();
+    ECONFIG.cy = ECONFIG.numrows ? (int) (testRandom() % ECONFIG.numrows) : 0;
+    char *before = testSnapshot(&beforelen);
+
+    char *new = testRandom() % 5 == 0 ? testGenerateLines(testRandom() % 12, &newlen) : testMutate(old, oldlen, &newlen);
+    char *want = testNormalize(new, newlen, &wantlen);
+    testWriteFile(path, new, newlen);
+    int rows = editorReload();
+    char *got = testSnapshot(&len);
+    int empty = newlen == 0 && (len == 0 || (len == 1 && got[0] == '\n')); /* an empty file opens as one empty row */
+    if (!empty && !testSame(got, len, want, wantlen)) testFail("round %d: reload gave a different buffer (%d rows)", round, rows);
+    if (ECONFIG.dirty) testFail("round %d: buffer dirty after reload", round);
+    if (round % 2) testCheckRowIndex(round);
+
+    /* saving writes back what was reloaded */
+    editorSave();
+    char *saved = testReadFile(path, &len);
+    char *savedwant = testNormalize(saved, len, &len);
+    if (!empty && !testSame(savedwant, len, want, wantlen)) testFail("round %d: save after reload wrote a different file", round);
+
+    /* the reload is one undo step */
+    editorUndo();
+    char *undone = testSnapshot(&len);
+    if (rows > 0 && !testSame(undone, len, before, beforelen)) testFail("round %d: undo of the reload differs", round);
+    editorRedo();
+    char *redone = testSnapshot(&len);
+    if (rows > 0 && !empty && !testSame(redone, len, want, wantlen)) testFail("round %d: redo of the reload differs", round);
+
+    free(old);
+    free(new);
+    free(want);
+    free(before);
+    free(got);
+    free(saved);
+    free(savedwant);
+    free(undone);
+    free(redone);
+  }
+  testResetEditor();
+  testUnlink(path);
+  printf("reload: %d rounds\n", rounds);
+}
+
+/* Generate a file where row j reads "row j" plus `words` copies of the given word */
+char *testGenerateWords(int lines, const char *word, size_t *len) {
+  size_t cap = 4096, n = 0;
+  char *s = malloc(cap);
+  int j, k;
+  for (j = 0; j < lines; j++) {
+    if (cap - n < 256) s = realloc(s, cap *= 2);
+    n += sprintf(s + n, "row %d", j);
+    for (k = 0; k < j % 7; k++) n += sprintf(s + n, " %s%d", word, k);
+    s[n++] = '\n';
+  }
+  *len = n;
+  return s;
+}
+
+/* Replace-all on a file, with and without the trigram index, saved, undone and reloaded */
+void testReplace(int argc, char **argv) {
+  int lines = argc > 0 ? atoi(argv[0]) : 2000;
+  const char *path = "test_replace.tmp";
+  size_t oldlen, newlen, len, savedlen;
+  char *old = testGenerateWords(lines, "alpha", &oldlen);
+  char *new = testGenerateWords(lines, "gamma-ray", &newlen);
+  long long want = 0;
+  int j, indexed;
+
+  for (j = 0; j < lines; j++) want += j % 7;
+  for (indexed = 0; indexed < 2; indexed++) {
+    setenv("FLY_TRIGRAM_MIN", indexed ? "0" : "1000000000", 1);
+    testResetEditor();
+    testWriteFile(path, old, oldlen);
+    editorOpen((char *) path);
+    if (indexed) {
+      /* saving drops the index under a find-all that is still reading it */
+      while (!__atomic_load_n(&ECONFIG.trigram.ready, __ATOMIC_ACQUIRE)) usleep(1000);
+      searchStart("alpha", 0);
+      editorSave();
+      char *saved = testReadFile(path, &savedlen);
+      if (!testSame(saved, savedlen, old, oldlen)) testFail("save during find-all: saved file differs");
+      free(saved);
+
+      testResetEditor();
+      editorOpen((char *) path);
+      while (!__atomic_load_n(&ECONFIG.trigram.ready, __ATOMIC_ACQUIRE)) usleep(1000);
+    }
+
+    long long count = editorReplaceAll("alpha", 0, "gamma-ray");
+    char *got = testSnapshot(&len);
+    if (count != want) testFail("replace-all (index %d): %lld replacements, expected %lld", indexed, count, want);
+    if (!testSame(got, len, new, newlen)) testFail("replace-all (index %d): buffer differs", indexed);
+    free(got);
+
+    editorSave();
+    char *saved = testReadFile(path, &savedlen);
+    if (!testSame(saved, savedlen, new, newlen)) testFail("replace-all (index %d): saved file differs", indexed);
+    free(saved);
+
+    editorUndo();
+    got = testSnapshot(&len);
+    if (!testSame(got, len, old, oldlen)) testFail("replace-all (index %d): undo differs", indexed);
+    free(got);
+
+    /* the file on disk still holds the replacements, reloading brings them back */
+    editorReload();
+    got = testSnapshot(&len);
+    if (!testSame(got, len, new, newlen)) testFail("replace-all (index %d): reload differs", indexed);
+    free(got);
+  }
+  testResetEditor();
+  testUnlink(path);
+  unsetenv("FLY_TRIGRAM_MIN");
+  free(old);
+  free(new);
+  printf("replace: %d rows\n", lines);
+}
+
+/* Length of the longest common subsequence of a and b, the plain quadratic way */
+int testLCS(const uint64_t *a, int n, const uint64_t *b, int m) {
+  int *dp = calloc((size_t) (n + 1) * (m + 1), sizeof(int));
+  int i, j;
+  for (i = n - 1; i >= 0; i--) {
+    for (j = m - 1; j >= 0; j--) {
+      int skip = dp[(i + 1) * (m + 1) + j] > dp[i * (m + 1) + j + 1] ? dp[(i + 1) * (m + 1) + j] : dp[i * (m + 1) + j + 1];
+      dp[i * (m + 1) + j] = a[i] == b[j] ? dp[(i + 1) * (m + 1) + j + 1] + 1 : skip;
+    }
+  }
+  int len = dp[0];
+  free(dp);
+  return len;
+}
+
+/* diffLines() on random sequences: the lines it keeps pair up in order and are as many as the LCS */
+void testDiff(int argc, char **argv) {
+  int rounds = argc > 0 ? atoi(argv[0]) : 20000;
+  uint64_t a[400], b[400];
+  unsigned char changeda[401], changedb[401];
+  int round, j;
+
+  for (round = 0; round < rounds; round++) {
+    int n = testRandom() % 60, m = testRandom() % 60, alphabet = 1 + testRandom() % 8;
+    if (round % 100 == 0) {
+      n = testRandom() % 400;
+      m = testRandom() % 400;
+    }
+    for (j = 0; j < n; j++) a[j] = testRandom() % alphabet;
+    for (j = 0; j < m; j++) b[j] = j < n && testRandom() % 3 == 0 ? a[j] : testRandom() % alphabet;
+    memset(changeda, 0, sizeof(changeda));
+    memset(changedb, 0, sizeof(changedb));
+    diffLines(a, n, b, m, changeda, changedb);
+
+    int i = 0, kept = 0, keptb = 0;
+    for (j = 0; j < m; j++) keptb += !changedb[j];
+    j = 0;
+    while (1) {
+      while (i < n && changeda[i]) i++;
+      while (j < m && changedb[j]) j++;
+      if (i == n || j == m) break;
+      if (a[i] != b[j]) {
+        testFail("round %d: kept lines %d and %d differ", round, i, j);
+        break;
+      }
+      i++;
+      j++;
+      kept++;
+    }
+    while (i < n && changeda[i]) i++;
+    while (j < m && changedb[j]) j++;
+    if (i != n || j != m || keptb != kept) testFail("round %d: kept lines don't pair up", round);
+
+    int lcs = testLCS(a, n, b, m);
+    if (kept != lcs) testFail("round %d: kept %d of %d/%d lines, the LCS has %d", round, kept, n, m, lcs);
+  }
+  printf("diff: %d rounds\n", rounds);
+}
+
+/* Open path the way a new session would, answering yes when it offers to recover a journal */
+void testRecover(const char *path) {
+  int answer[2], in = dup(STDIN_FILENO), out = dup(STDOUT_FILENO), null = open("/dev/null", O_WRONLY);
+  if (pipe(answer) == -1 || write(answer[1], "y", 1) != 1) die("pipe");
+  close(answer[1]);
+  dup2(answer[0], STDIN_FILENO);
+  close(answer[0]);
+  fflush(stdout);
+  dup2(null, STDOUT_FILENO); /* the prompt redraws the screen */
+  close(null);
+
+  testResetEditor();
+  editorOpen((char *) path);
+
+  dup2(in, STDIN_FILENO);
+  dup2(out, STDOUT_FILENO);
+  close(in);
+  close(out);
+}
+
+/* Random typing, line breaks, backspaces and undos all over the buffer */
+void testEdit(int edits) {
+  int j;
+  for (j = 0; j < edits; j++) {
+    ECONFIG.cy = testRandom() % ECONFIG.numrows;
+    ECONFIG.cx = testRandom() % (ECONFIG.row[ECONFIG.cy].size + 1);
+    switch (testRandom() % 10) {
+      case 0:
+        editorInsertNewLine();
+        break;
+      case 1:
+      case 2:
+        editorDelChar();
+        break;
+      case 3:
+        if (testRandom() % 8 == 0) {
+          editorUndo();
+          break;
+        }
+        /* fall through */
+      default:
+        editorInsertChar('a' + testRandom() % 26);
+    }
+    if (testRandom() % 4 == 0) undoBreak();
+  }
+}
+
+/* Edits replayed from the journal, one that stops at a record that doesn't apply, and a short write */
+void testJournal(int argc, char **argv) {
+  int edits = argc > 0 ? atoi(argv[0]) : 3000;
+  const char *path = "test_journal.tmp";
+  struct editorJournal *j = &ECONFIG.journal;
+  size_t len, wantlen;
+  char *want, *got;
+  int k;
+
+  testResetEditor();
+  testUnlink(path);
+  FILE *fp = fopen(path, "w");
+  if (!fp) die("fopen");
+  for (k = 0; k < 200; k++) fprintf(fp, "line %d of the journal test\n", k);
+  fclose(fp);
+  editorOpen((char *) path);
+
+  /* several frames, the last one written out by the idle flush */
+  for (k = 0; k < edits; k += 250) {
+    testEdit(edits - k < 250 ? edits - k : 250);
+    journalFlush(0);
+  }
+  journalFlush(1);
+  want = testSnapshot(&wantlen);
+  testRecover(path);
+  got = testSnapshot(&len);
+  if (!testSame(got, len, want, wantlen)) testFail("journal: recovered buffer differs after %d edits", edits);
+  if (ECONFIG.dirty == 0) testFail("journal: recovered buffer not dirty");
+  free(got);
+
+  /* a frame whose second record doesn't apply: the first is kept, the journal cut before the frame */
+  journalRecord(JOURNAL_INSERT_ROW, 0, 3, "new", 3);
+  journalRecord(JOURNAL_DEL_ROW, 1 << 20, 0, NULL, 0);
+  journalRecord(JOURNAL_INSERT_ROW, 0, 3, "bad", 3);
+  journalFlush(1);
+  want = realloc(want, wantlen + 4);
+  memmove(want + 4, want, wantlen);
+  memcpy(want, "new\n", 4);
+  wantlen += 4;
+  testRecover(path);
+  got = testSnapshot(&len);
+  if (!testSame(got, len, want, wantlen)) testFail("journal: partly recovered buffer differs");
+  if (strstr(ECONFIG.statusmsg, "did not apply") == NULL) testFail("journal: partial recovery not reported");
+  free(got);
+  journalFlush(1);
+  testRecover(path);
+  got = testSnapshot(&len);
+  if (!testSame(got, len, want, wantlen)) testFail("journal: buffer differs after recovering the cut journal");
+  if (strstr(ECONFIG.statusmsg, "did not apply")) testFail("journal: cut journal still has records that don't apply");
+  free(got);
+
+  /* a frame cut short by the file size limit is taken back and written again later */
+  struct rlimit limit, saved;
+  struct stat st;
+  getrlimit(RLIMIT_FSIZE, &saved);
+  signal(SIGXFSZ, SIG_IGN);
+  testEdit(50);
+  fstat(j->fd, &st);
+  limit = saved;
+  limit.rlim_cur = st.st_size + 16;
+  setrlimit(RLIMIT_FSIZE, &limit);
+  journalFlush(1);
+  setrlimit(RLIMIT_FSIZE, &saved);
+  struct stat cut;
+  fstat(j->fd, &cut);
+  if (strstr(ECONFIG.statusmsg, "will retry") == NULL) testFail("journal: short write not reported");
+  if (cut.st_size != st.st_size || j->len == 0) testFail("journal: short write left %lld bytes, %zu buffered",
+    (long long) (cut.st_size - st.st_size), j->len);
+  journalFlush(1);
+  free(want);
+  want = testSnapshot(&wantlen);
+  testRecover(path);
+  got = testSnapshot(&len);
+  if (!testSame(got, len, want, wantlen)) testFail("journal: buffer differs after a short write");
+  free(got);
+  free(want);
+
+  testResetEditor();
+  testUnlink(path);
+  printf("journal: %d edits\n", edits);
+}
+
+struct {
+  const char *name;
+  const char *usage;
+  void (*run)(int argc, char **argv);
+} tests[] = {
+  {"reload", "[rounds=300]", testReload},
+  {"replace", "[lines=2000]", testReplace},
+  {"diff", "[rounds=20000]", testDiff},
+  {"journal", "[edits=3000]", testJournal},
+};
+
+int main(int argc, char *argv[]) {
+  unsigned int j;
+  int found = 0;
+  testResetEditor();
+  for (j = 0; j < sizeof(tests) / sizeof(tests[0]); j++) {
+    if (argc >= 2 && strcmp(argv[1], tests[j].name) != 0) continue;
+    tests[j].run(argc > 2 ? argc - 2 : 0, argv + 2);
+    found = 1;
+  }
+
+  if (!found) {
+    fprintf(stderr, "usage: %s [test] [args]\n", argv[0]);
+    for (j = 0; j < sizeof(tests) / sizeof(tests[0]); j++) {
+      fprintf(stderr, "  %s %s\n", tests[j].name, tests[j].usage);
+    }
+    return 1;
+  }
+  printf("%s: %d failed checks\n", testFailures ? "FAIL" : "ok", testFailures);
+  return testFailures != 0;
+}